@@ -0,0 +1,236 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <type_traits>
+
+#include "bitflags.hpp"
+#include "defaults.hpp"
+#include "language.hpp"
+#include "types.hpp"
+
+#ifdef PLATFORM_LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif// PLATFORM_LINUX
+
+namespace kstd {
+    /**
+     * Lock-free atomic storage for an enum declared with KSTD_BITFLAGS.
+     * All operations take explicit memory orders, mirroring std::atomic.
+     * Threads may block in wait_until_set, which is backed by a futex on Linux
+     * (std::atomic::wait on C++20 elsewhere). Writers only touch the waiter
+     * count when they newly set a bit, and only pay for a wakeup when there
+     * actually is a waiting thread.
+     *
+     * @tparam E The bitflags type stored within the atomic.
+     */
+    template<typename E>
+    class AtomicFlags final {
+        static_assert(is_bitflags_v<E>, "Type must be declared using KSTD_BITFLAGS");
+
+        public:
+        using ValueType = E;
+        using Self = AtomicFlags<ValueType>;
+        using RawType = std::make_unsigned_t<std::underlying_type_t<ValueType>>;
+
+        private:
+        std::atomic<RawType> _value;
+        std::atomic<u32> _epoch;
+        std::atomic<u32> _waiters;
+
+        [[nodiscard]] static constexpr auto to_raw(ValueType value) noexcept -> RawType {
+            return static_cast<RawType>(value);
+        }
+
+        [[nodiscard]] static constexpr auto from_raw(RawType value) noexcept -> ValueType {
+            return static_cast<ValueType>(value);
+        }
+
+        inline auto notify(RawType previous, RawType current) noexcept -> void {
+            // Waiters only ever wait for bits to become set
+            if((current & static_cast<RawType>(~previous)) == 0) {
+                return;
+            }
+            // Pairs with the increment of _waiters in wait_until_set; as both sides are RMWs on the
+            // same variable, either we observe the waiter or the waiter observes the new value.
+            if(_waiters.fetch_add(0, std::memory_order_seq_cst) == 0) {
+                return;
+            }
+            _epoch.fetch_add(1, std::memory_order_release);
+#if defined(PLATFORM_LINUX)
+            ::syscall(SYS_futex, &_epoch, FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#elif defined(KSTD_CPP_20)
+            _epoch.notify_all();
+#endif
+        }
+
+        inline auto block(u32 epoch) noexcept -> void {
+#if defined(PLATFORM_LINUX)
+            static_assert(sizeof(std::atomic<u32>) == sizeof(u32), "Futex word must be exactly 32 bits");
+            ::syscall(SYS_futex, &_epoch, FUTEX_WAIT_PRIVATE, epoch, nullptr, nullptr, 0);
+#elif defined(KSTD_CPP_20)
+            _epoch.wait(epoch, std::memory_order_acquire);
+#else
+            if(_epoch.load(std::memory_order_acquire) == epoch) {
+                std::this_thread::yield();
+            }
+#endif
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(AtomicFlags, Self, constexpr)
+
+        constexpr AtomicFlags() noexcept :
+                _value {0},
+                _epoch {0},
+                _waiters {0} {
+        }
+
+        explicit constexpr AtomicFlags(ValueType value) noexcept :
+                _value {to_raw(value)},
+                _epoch {0},
+                _waiters {0} {
+        }
+
+        ~AtomicFlags() noexcept = default;
+
+        [[nodiscard]] inline auto load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+                -> ValueType {
+            return from_raw(_value.load(order));
+        }
+
+        inline auto store(ValueType value, std::memory_order order = std::memory_order_seq_cst) noexcept -> void {
+            // Exchange instead of store so we know whether any bits were newly set
+            const auto previous = _value.exchange(to_raw(value), order);
+            notify(previous, to_raw(value));
+        }
+
+        inline auto exchange(ValueType value, std::memory_order order = std::memory_order_seq_cst) noexcept
+                -> ValueType {
+            const auto previous = _value.exchange(to_raw(value), order);
+            notify(previous, to_raw(value));
+            return from_raw(previous);
+        }
+
+        /**
+         * Atomically sets the given flags.
+         *
+         * @param flags The flags to set.
+         * @param order The memory order of the read-modify-write operation.
+         * @return The value before the flags were set.
+         */
+        inline auto fetch_set(ValueType flags, std::memory_order order = std::memory_order_seq_cst) noexcept
+                -> ValueType {
+            const auto previous = _value.fetch_or(to_raw(flags), order);
+            notify(previous, previous | to_raw(flags));
+            return from_raw(previous);
+        }
+
+        /**
+         * Atomically clears the given flags.
+         *
+         * @param flags The flags to clear.
+         * @param order The memory order of the read-modify-write operation.
+         * @return The value before the flags were cleared.
+         */
+        inline auto fetch_clear(ValueType flags, std::memory_order order = std::memory_order_seq_cst) noexcept
+                -> ValueType {
+            return from_raw(_value.fetch_and(static_cast<RawType>(~to_raw(flags)), order));
+        }
+
+        inline auto fetch_toggle(ValueType flags, std::memory_order order = std::memory_order_seq_cst) noexcept
+                -> ValueType {
+            const auto previous = _value.fetch_xor(to_raw(flags), order);
+            notify(previous, previous ^ to_raw(flags));
+            return from_raw(previous);
+        }
+
+        /**
+         * @param flags The flags to check for.
+         * @param order The memory order of the load.
+         * @return True if all of the given flags are currently set.
+         */
+        [[nodiscard]] inline auto test(ValueType flags, std::memory_order order = std::memory_order_seq_cst) const noexcept
+                -> bool {
+            return (_value.load(order) & to_raw(flags)) == to_raw(flags);
+        }
+
+        /**
+         * Atomically sets the given flags.
+         *
+         * @param flags The flags to set.
+         * @param order The memory order of the read-modify-write operation.
+         * @return True if all of the given flags were already set before.
+         */
+        inline auto test_and_set(ValueType flags, std::memory_order order = std::memory_order_seq_cst) noexcept
+                -> bool {
+            return (to_raw(fetch_set(flags, order)) & to_raw(flags)) == to_raw(flags);
+        }
+
+        inline auto compare_exchange(ValueType& expected, ValueType desired, std::memory_order success,
+                                     std::memory_order failure) noexcept -> bool {
+            auto raw_expected = to_raw(expected);
+            if(!_value.compare_exchange_strong(raw_expected, to_raw(desired), success, failure)) {
+                expected = from_raw(raw_expected);
+                return false;
+            }
+            notify(raw_expected, to_raw(desired));
+            return true;
+        }
+
+        inline auto compare_exchange(ValueType& expected, ValueType desired,
+                                     std::memory_order order = std::memory_order_seq_cst) noexcept -> bool {
+            return compare_exchange(expected, desired, order,
+                                    order == std::memory_order_acq_rel   ? std::memory_order_acquire
+                                    : order == std::memory_order_release ? std::memory_order_relaxed
+                                                                         : order);
+        }
+
+        /**
+         * Blocks the calling thread until all of the given flags are set.
+         *
+         * @param flags The flags to wait for.
+         * @param order The memory order used for loading the flags.
+         * @return The value which satisfied the condition.
+         */
+        inline auto wait_until_set(ValueType flags, std::memory_order order = std::memory_order_seq_cst) noexcept
+                -> ValueType {
+            auto value = _value.load(order);
+            if((value & to_raw(flags)) == to_raw(flags)) {
+                return from_raw(value);// Fast path, no need to register as a waiter
+            }
+            _waiters.fetch_add(1, std::memory_order_seq_cst);
+            while(true) {
+                const auto epoch = _epoch.load(std::memory_order_acquire);
+                value = _value.load(std::memory_order_seq_cst);
+                if((value & to_raw(flags)) == to_raw(flags)) {
+                    break;
+                }
+                block(epoch);
+            }
+            _waiters.fetch_sub(1, std::memory_order_relaxed);
+            return from_raw(value);
+        }
+    };
+}// namespace kstd
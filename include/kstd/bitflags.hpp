@@ -19,6 +19,127 @@
 
 #pragma once
 
+#include <array>
+#include <fmt/format.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "bits.hpp"
+#include "macros.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    template<typename E>
+    struct BitflagsEntry final {
+        std::string_view name;
+        E value;
+    };
+
+    template<typename E, typename = void>
+    struct IsBitflags : std::false_type {};
+
+    template<typename E>
+    struct IsBitflags<E, std::void_t<decltype(kstd_get_bitflags_entries(std::declval<E>()))>> : std::true_type {};
+
+    template<typename E>
+    constexpr bool is_bitflags_v = IsBitflags<E>::value;
+}// namespace kstd
+
+namespace kstd::bitflags {
+    /*
+     * Helper which swallows the initializer of an enumerator when used as
+     * (Assignable<T>) NAME = VALUE, so the value of NAME can be retrieved
+     * from the enumerator list passed to KSTD_BITFLAGS.
+     */
+    template<typename T>
+    struct Assignable final {
+        T value;
+
+        explicit constexpr Assignable(T value) noexcept :
+                value {value} {
+        }
+
+        template<typename U>
+        constexpr auto operator=([[maybe_unused]] U&& initializer) noexcept -> Assignable {// NOLINT
+            return *this;
+        }
+    };
+
+    [[nodiscard]] constexpr auto parse_name(const char* enumerator) noexcept -> std::string_view {
+        while(*enumerator == ' ') {
+            ++enumerator;
+        }
+        usize length = 0;
+        for(auto current = enumerator[length]; current == '_' || (current >= 'a' && current <= 'z') ||
+                                               (current >= 'A' && current <= 'Z') ||
+                                               (current >= '0' && current <= '9');
+            current = enumerator[++length]) {
+        }
+        return {enumerator, length};
+    }
+
+    template<typename E, typename F>
+    constexpr auto for_each_set(E value, F&& function) noexcept -> void {
+        using UnsignedType = std::make_unsigned_t<std::underlying_type_t<E>>;
+        bits::for_each_set_bit(static_cast<UnsignedType>(value), [&function](const usize index) {
+            function(static_cast<E>(static_cast<UnsignedType>(UnsignedType {1} << index)));
+        });
+    }
+
+    template<typename E>
+    [[nodiscard]] constexpr auto get_name(E value) noexcept -> std::string_view {
+        for(const auto& entry : kstd_get_bitflags_entries(value)) {
+            if(entry.value == value) {
+                return entry.name;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * Creates a string representation of the given flags in the form
+     * of "FOO | BAR", using the name of every single set bit.
+     * Bits without a name are rendered in hexadecimal.
+     *
+     * @tparam E The bitflags type of the given value.
+     * @param value The value to convert into a string.
+     * @return A new string which contains the names of all set flags.
+     */
+    template<typename E>
+    [[nodiscard]] inline auto to_string(E value) noexcept -> std::string {
+        using UnsignedType = std::make_unsigned_t<std::underlying_type_t<E>>;
+        if(static_cast<UnsignedType>(value) == 0) {
+            return "NONE";
+        }
+        std::string result {};
+        for_each_set(value, [&result](const E flag) {
+            if(!result.empty()) {
+                result += " | ";
+            }
+            const auto name = get_name(flag);
+            if(name.empty()) {
+                result += fmt::format("{:#x}", static_cast<UnsignedType>(flag));
+                return;
+            }
+            result += name;
+        });
+        return result;
+    }
+}// namespace kstd::bitflags
+
+template<typename E>
+struct fmt::formatter<E, char, std::enable_if_t<kstd::is_bitflags_v<E>>> : fmt::formatter<std::string_view> {
+    template<typename CONTEXT>
+    auto format(E value, CONTEXT& context) const -> decltype(context.out()) {
+        return fmt::formatter<std::string_view>::format(kstd::bitflags::to_string(value), context);
+    }
+};
+
+#define KSTD_BITFLAGS_ENTRY(n, x) kstd::BitflagsEntry<n> {kstd::bitflags::parse_name(#x), \
+    static_cast<n>(((kstd::bitflags::Assignable<std::underlying_type_t<n>>) x).value)},
+
 // clang-format off
 #define KSTD_BITFLAGS(t, n, ...) enum class n : t {                  \
     NONE = 0,                                                        \
@@ -47,5 +168,31 @@ constexpr auto operator &=(n& a, n b) noexcept -> n& {               \
 constexpr auto operator ^=(n& a, n b) noexcept -> n& {               \
     a = a ^ b;                                                       \
     return a;                                                        \
+}                                                                    \
+[[nodiscard]] constexpr auto contains(n a, n b) noexcept -> bool {   \
+    return (static_cast<t>(a) & static_cast<t>(b)) == static_cast<t>(b); \
+}                                                                    \
+[[nodiscard]] constexpr auto any(n a, n b) noexcept -> bool {        \
+    return (static_cast<t>(a) & static_cast<t>(b)) != 0;             \
+}                                                                    \
+[[nodiscard]] constexpr auto any(n x) noexcept -> bool {             \
+    return static_cast<t>(x) != 0;                                   \
+}                                                                    \
+[[nodiscard]] constexpr auto count(n x) noexcept -> kstd::usize {    \
+    return kstd::bits::popcount(static_cast<std::make_unsigned_t<t>>(x)); \
+}                                                                    \
+template<typename F>                                                 \
+constexpr auto for_each_set(n x, F&& function) noexcept -> void {    \
+    kstd::bitflags::for_each_set(x, std::forward<F>(function));      \
+}                                                                    \
+[[nodiscard]] inline auto to_string(n x) noexcept -> std::string {   \
+    return kstd::bitflags::to_string(x);                             \
+}                                                                    \
+[[nodiscard]] constexpr auto kstd_get_bitflags_entries(n) noexcept { \
+    enum : t {                                                       \
+        NONE = 0,                                                    \
+        __VA_ARGS__                                                  \
+    };                                                               \
+    return std::array {KSTD_FOR_EACH(KSTD_BITFLAGS_ENTRY, n, __VA_ARGS__)}; \
 }
-// clang-format on
\ No newline at end of file
+// clang-format on
@@ -0,0 +1,130 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <type_traits>
+
+#include "language.hpp"
+#include "types.hpp"
+
+#ifdef KSTD_CPP_20
+#include <bit>
+#endif// KSTD_CPP_20
+
+namespace kstd::bits {
+    /**
+     * @tparam T The unsigned integer type of the given value.
+     * @param value The value of which to count all set bits.
+     * @return The number of bits which are set in the given value.
+     */
+    template<typename T>
+    [[nodiscard]] constexpr auto popcount(T value) noexcept -> usize {
+        static_assert(std::is_unsigned_v<T>, "Type must be an unsigned integer");
+#if defined(__GNUC__) || defined(__clang__)
+        if constexpr(sizeof(T) <= sizeof(unsigned int)) {
+            return static_cast<usize>(__builtin_popcount(value));
+        }
+        else {
+            return static_cast<usize>(__builtin_popcountll(value));
+        }
+#elif defined(KSTD_CPP_20)
+        return static_cast<usize>(std::popcount(value));
+#else
+        usize count = 0;
+        while(value != 0) {
+            value &= value - 1;
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    /**
+     * @tparam T The unsigned integer type of the given value.
+     * @param value The value of which to count the trailing zeros, must not be zero.
+     * @return The index of the lowest bit set in the given value.
+     */
+    template<typename T>
+    [[nodiscard]] constexpr auto count_trailing_zeros(T value) noexcept -> usize {
+        static_assert(std::is_unsigned_v<T>, "Type must be an unsigned integer");
+#if defined(__GNUC__) || defined(__clang__)
+        if constexpr(sizeof(T) <= sizeof(unsigned int)) {
+            return static_cast<usize>(__builtin_ctz(value));
+        }
+        else {
+            return static_cast<usize>(__builtin_ctzll(value));
+        }
+#elif defined(KSTD_CPP_20)
+        return static_cast<usize>(std::countr_zero(value));
+#else
+        usize count = 0;
+        while((value & 1) == 0) {
+            value >>= 1;
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    /**
+     * @tparam T The unsigned integer type of the given value.
+     * @param value The value of which to count the leading zeros, must not be zero.
+     * @return The number of zero bits above the highest bit set in the given value.
+     */
+    template<typename T>
+    [[nodiscard]] constexpr auto count_leading_zeros(T value) noexcept -> usize {
+        static_assert(std::is_unsigned_v<T>, "Type must be an unsigned integer");
+        constexpr usize bit_count = sizeof(T) << 3;
+#if defined(__GNUC__) || defined(__clang__)
+        if constexpr(sizeof(T) <= sizeof(unsigned int)) {
+            return static_cast<usize>(__builtin_clz(value)) - ((sizeof(unsigned int) << 3) - bit_count);
+        }
+        else {
+            return static_cast<usize>(__builtin_clzll(value)) - ((sizeof(unsigned long long) << 3) - bit_count);
+        }
+#elif defined(KSTD_CPP_20)
+        return static_cast<usize>(std::countl_zero(value));
+#else
+        usize count = 0;
+        for(auto mask = static_cast<T>(T {1} << (bit_count - 1)); (value & mask) == 0; mask >>= 1) {
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    /**
+     * Invokes the given function with the index of every bit set in the given value,
+     * starting at the lowest bit.
+     *
+     * @tparam T The unsigned integer type of the given value.
+     * @tparam F The type of the function to invoke.
+     * @param value The value of which to iterate all set bits.
+     * @param function The function to invoke with the index of every set bit.
+     */
+    template<typename T, typename F>
+    constexpr auto for_each_set_bit(T value, F&& function) noexcept -> void {
+        static_assert(std::is_unsigned_v<T>, "Type must be an unsigned integer");
+        while(value != 0) {
+            function(count_trailing_zeros(value));
+            value &= static_cast<T>(value - 1);
+        }
+    }
+}// namespace kstd::bits
@@ -0,0 +1,604 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "assert.hpp"
+#include "bits.hpp"
+#include "defaults.hpp"
+#include "hash.hpp"
+#include "option.hpp"
+#include "slice.hpp"
+#include "types.hpp"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif// __AVX2__
+
+namespace kstd::bits {
+    constexpr usize word_bits = 64;
+
+    [[nodiscard]] constexpr auto get_word_count(usize bit_count) noexcept -> usize {
+        return (bit_count + (word_bits - 1)) / word_bits;
+    }
+
+    // NOLINTBEGIN
+#ifdef __AVX2__
+#define KSTD_BITSET_KERNEL(n, scalar, vector)                                                                          \
+    inline auto n(u64* destination, const u64* source, usize count) noexcept -> void {                                 \
+        usize index = 0;                                                                                               \
+        for(; index + 4 <= count; index += 4) {                                                                        \
+            const auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destination + index));                  \
+            const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + index));                       \
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + index), vector(a, b));                        \
+        }                                                                                                              \
+        for(; index < count; ++index) {                                                                                \
+            destination[index] = scalar(destination[index], source[index]);                                            \
+        }                                                                                                              \
+    }
+#else
+#define KSTD_BITSET_KERNEL(n, scalar, vector)                                                                          \
+    inline auto n(u64* destination, const u64* source, usize count) noexcept -> void {                                 \
+        for(usize index = 0; index < count; ++index) {                                                                 \
+            destination[index] = scalar(destination[index], source[index]);                                           \
+        }                                                                                                              \
+    }
+#endif// __AVX2__
+
+#define KSTD_BITSET_AND(a, b) ((a) & (b))
+#define KSTD_BITSET_OR(a, b) ((a) | (b))
+#define KSTD_BITSET_XOR(a, b) ((a) ^ (b))
+#define KSTD_BITSET_AND_NOT(a, b) ((a) & ~(b))
+#define KSTD_BITSET_AND_NOT_VECTOR(a, b) _mm256_andnot_si256(b, a)
+
+    KSTD_BITSET_KERNEL(and_words, KSTD_BITSET_AND, _mm256_and_si256)
+    KSTD_BITSET_KERNEL(or_words, KSTD_BITSET_OR, _mm256_or_si256)
+    KSTD_BITSET_KERNEL(xor_words, KSTD_BITSET_XOR, _mm256_xor_si256)
+    KSTD_BITSET_KERNEL(and_not_words, KSTD_BITSET_AND_NOT, KSTD_BITSET_AND_NOT_VECTOR)
+
+#undef KSTD_BITSET_AND_NOT_VECTOR
+#undef KSTD_BITSET_AND_NOT
+#undef KSTD_BITSET_XOR
+#undef KSTD_BITSET_OR
+#undef KSTD_BITSET_AND
+#undef KSTD_BITSET_KERNEL
+    // NOLINTEND
+
+    [[nodiscard]] inline auto popcount_words(const u64* words, usize count) noexcept -> usize {
+        // Four independent accumulators keep the popcnt units busy
+        usize a = 0;
+        usize b = 0;
+        usize c = 0;
+        usize d = 0;
+        usize index = 0;
+        for(; index + 4 <= count; index += 4) {
+            a += popcount(words[index]);
+            b += popcount(words[index + 1]);
+            c += popcount(words[index + 2]);
+            d += popcount(words[index + 3]);
+        }
+        for(; index < count; ++index) {
+            a += popcount(words[index]);
+        }
+        return a + b + c + d;
+    }
+
+    /**
+     * @param words The words to search.
+     * @param count The number of words to search.
+     * @param bit_index The index of the bit to start searching at.
+     * @return The index of the first set bit at or after the given index, if any.
+     */
+    [[nodiscard]] inline auto find_next_set(const u64* words, usize count, usize bit_index) noexcept
+            -> Option<usize> {
+        auto word_index = bit_index / word_bits;
+        if(word_index >= count) {
+            return {};
+        }
+        auto word = words[word_index] & (~u64 {0} << (bit_index % word_bits));
+        while(word == 0) {
+            if(++word_index >= count) {
+                return {};
+            }
+            word = words[word_index];
+        }
+        return word_index * word_bits + count_trailing_zeros(word);
+    }
+
+    /**
+     * @param word The word to search.
+     * @param rank The zero-based rank of the set bit to find, must be less than popcount(word).
+     * @return The index of the set bit with the given rank within the given word.
+     */
+    [[nodiscard]] inline auto select_in_word(u64 word, usize rank) noexcept -> usize {
+#ifdef __BMI2__
+        return count_trailing_zeros(_pdep_u64(u64 {1} << rank, word));
+#else
+        for(; rank > 0; --rank) {
+            word &= word - 1;
+        }
+        return count_trailing_zeros(word);
+#endif// __BMI2__
+    }
+}// namespace kstd::bits
+
+namespace kstd {
+    /**
+     * A fixed-size set of bits stored inline in 64-bit words.
+     * Bulk operations work on whole words (and AVX2 registers when available),
+     * all bits past SIZE are guaranteed to be zero at all times.
+     *
+     * @tparam SIZE The number of bits stored within the set.
+     */
+    template<usize SIZE>
+    struct Bitset final {
+        using Self = Bitset<SIZE>;
+
+        static constexpr usize size = SIZE;
+        static constexpr usize word_count = bits::get_word_count(SIZE);
+
+        friend struct std::hash<Self>;
+
+        private:
+        std::array<u64, word_count> _words;
+
+        constexpr auto trim() noexcept -> void {
+            if constexpr((size % bits::word_bits) != 0) {
+                _words[word_count - 1] &= (u64 {1} << (size % bits::word_bits)) - 1;
+            }
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(Bitset, Self, constexpr)
+
+        constexpr Bitset() noexcept :
+                _words {} {
+        }
+
+        ~Bitset() noexcept = default;
+
+        constexpr auto set(usize index, bool value = true) noexcept -> void {
+            assert_true(index < size);
+            const auto mask = u64 {1} << (index % bits::word_bits);
+            auto& word = _words[index / bits::word_bits];
+            word = value ? (word | mask) : (word & ~mask);
+        }
+
+        constexpr auto reset(usize index) noexcept -> void {
+            set(index, false);
+        }
+
+        constexpr auto flip(usize index) noexcept -> void {
+            assert_true(index < size);
+            _words[index / bits::word_bits] ^= u64 {1} << (index % bits::word_bits);
+        }
+
+        [[nodiscard]] constexpr auto test(usize index) const noexcept -> bool {
+            assert_true(index < size);
+            return ((_words[index / bits::word_bits] >> (index % bits::word_bits)) & 1) != 0;
+        }
+
+        constexpr auto set_all() noexcept -> void {
+            std::fill(_words.begin(), _words.end(), ~u64 {0});
+            trim();
+        }
+
+        constexpr auto clear() noexcept -> void {
+            std::fill(_words.begin(), _words.end(), u64 {0});
+        }
+
+        constexpr auto flip_all() noexcept -> void {
+            for(auto& word : _words) {
+                word = ~word;
+            }
+            trim();
+        }
+
+        [[nodiscard]] inline auto count() const noexcept -> usize {
+            return bits::popcount_words(_words.data(), word_count);
+        }
+
+        [[nodiscard]] constexpr auto any() const noexcept -> bool {
+            for(const auto word : _words) {
+                if(word != 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        [[nodiscard]] constexpr auto none() const noexcept -> bool {
+            return !any();
+        }
+
+        [[nodiscard]] inline auto all() const noexcept -> bool {
+            return count() == size;
+        }
+
+        [[nodiscard]] inline auto find_first() const noexcept -> Option<usize> {
+            return bits::find_next_set(_words.data(), word_count, 0);
+        }
+
+        /**
+         * @param index The index at which to start searching (inclusive).
+         * @return The index of the first set bit at or after the given index, if any.
+         */
+        [[nodiscard]] inline auto find_next(usize index) const noexcept -> Option<usize> {
+            return bits::find_next_set(_words.data(), word_count, index);
+        }
+
+        template<typename F>
+        constexpr auto for_each_set(F&& function) const noexcept -> void {
+            for(usize index = 0; index < word_count; ++index) {
+                bits::for_each_set_bit(_words[index], [&function, index](const usize bit) {
+                    function(index * bits::word_bits + bit);
+                });
+            }
+        }
+
+        inline auto and_not(const Self& other) noexcept -> Self& {
+            bits::and_not_words(_words.data(), other._words.data(), word_count);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr auto get_words() noexcept -> Slice<u64> {
+            return {_words.data(), word_count * sizeof(u64)};
+        }
+
+        [[nodiscard]] constexpr auto get_words() const noexcept -> Slice<const u64> {
+            return {_words.data(), word_count * sizeof(u64)};
+        }
+
+        [[nodiscard]] constexpr auto get_size() const noexcept -> usize {
+            return size;
+        }
+
+        [[nodiscard]] constexpr auto operator[](usize index) const noexcept -> bool {
+            return test(index);
+        }
+
+        inline auto operator&=(const Self& other) noexcept -> Self& {
+            bits::and_words(_words.data(), other._words.data(), word_count);
+            return *this;
+        }
+
+        inline auto operator|=(const Self& other) noexcept -> Self& {
+            bits::or_words(_words.data(), other._words.data(), word_count);
+            return *this;
+        }
+
+        inline auto operator^=(const Self& other) noexcept -> Self& {
+            bits::xor_words(_words.data(), other._words.data(), word_count);
+            return *this;
+        }
+
+        [[nodiscard]] inline auto operator&(const Self& other) const noexcept -> Self {
+            auto result = *this;
+            return result &= other;
+        }
+
+        [[nodiscard]] inline auto operator|(const Self& other) const noexcept -> Self {
+            auto result = *this;
+            return result |= other;
+        }
+
+        [[nodiscard]] inline auto operator^(const Self& other) const noexcept -> Self {
+            auto result = *this;
+            return result ^= other;
+        }
+
+        [[nodiscard]] constexpr auto operator~() const noexcept -> Self {
+            auto result = *this;
+            result.flip_all();
+            return result;
+        }
+
+        [[nodiscard]] constexpr auto operator==(const Self& other) const noexcept -> bool {
+            return _words == other._words;
+        }
+
+        [[nodiscard]] constexpr auto operator!=(const Self& other) const noexcept -> bool {
+            return _words != other._words;
+        }
+    };
+
+    /**
+     * A resizable set of bits stored in heap-allocated 64-bit words.
+     * Provides the same operations as kstd::Bitset; binary operations
+     * require both operands to be of the same size.
+     */
+    class DynamicBitset final {
+        std::vector<u64> _words;
+        usize _size;
+
+        friend struct std::hash<DynamicBitset>;
+
+        inline auto trim() noexcept -> void {
+            if((_size % bits::word_bits) != 0) {
+                _words.back() &= (u64 {1} << (_size % bits::word_bits)) - 1;
+            }
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(DynamicBitset, DynamicBitset, inline)
+
+        DynamicBitset() noexcept :
+                _words {},
+                _size {0} {
+        }
+
+        explicit DynamicBitset(usize size, bool value = false) noexcept :
+                _words(bits::get_word_count(size), value ? ~u64 {0} : u64 {0}),
+                _size {size} {
+            trim();
+        }
+
+        ~DynamicBitset() noexcept = default;
+
+        inline auto resize(usize size, bool value = false) noexcept -> void {
+            const auto old_size = _size;
+            _words.resize(bits::get_word_count(size), value ? ~u64 {0} : u64 {0});
+            _size = size;
+            if(value && size > old_size && (old_size % bits::word_bits) != 0) {
+                _words[old_size / bits::word_bits] |= ~u64 {0} << (old_size % bits::word_bits);
+            }
+            trim();
+        }
+
+        inline auto push_back(bool value) noexcept -> void {
+            if((_size % bits::word_bits) == 0) {
+                _words.push_back(0);
+            }
+            ++_size;
+            set(_size - 1, value);
+        }
+
+        inline auto set(usize index, bool value = true) noexcept -> void {
+            assert_true(index < _size);
+            const auto mask = u64 {1} << (index % bits::word_bits);
+            auto& word = _words[index / bits::word_bits];
+            word = value ? (word | mask) : (word & ~mask);
+        }
+
+        inline auto reset(usize index) noexcept -> void {
+            set(index, false);
+        }
+
+        inline auto flip(usize index) noexcept -> void {
+            assert_true(index < _size);
+            _words[index / bits::word_bits] ^= u64 {1} << (index % bits::word_bits);
+        }
+
+        [[nodiscard]] inline auto test(usize index) const noexcept -> bool {
+            assert_true(index < _size);
+            return ((_words[index / bits::word_bits] >> (index % bits::word_bits)) & 1) != 0;
+        }
+
+        inline auto set_all() noexcept -> void {
+            std::fill(_words.begin(), _words.end(), ~u64 {0});
+            trim();
+        }
+
+        inline auto clear() noexcept -> void {
+            std::fill(_words.begin(), _words.end(), u64 {0});
+        }
+
+        inline auto flip_all() noexcept -> void {
+            for(auto& word : _words) {
+                word = ~word;
+            }
+            trim();
+        }
+
+        [[nodiscard]] inline auto count() const noexcept -> usize {
+            return bits::popcount_words(_words.data(), _words.size());
+        }
+
+        [[nodiscard]] inline auto any() const noexcept -> bool {
+            return std::any_of(_words.cbegin(), _words.cend(), [](const u64 word) {
+                return word != 0;
+            });
+        }
+
+        [[nodiscard]] inline auto none() const noexcept -> bool {
+            return !any();
+        }
+
+        [[nodiscard]] inline auto all() const noexcept -> bool {
+            return count() == _size;
+        }
+
+        [[nodiscard]] inline auto find_first() const noexcept -> Option<usize> {
+            return bits::find_next_set(_words.data(), _words.size(), 0);
+        }
+
+        /**
+         * @param index The index at which to start searching (inclusive).
+         * @return The index of the first set bit at or after the given index, if any.
+         */
+        [[nodiscard]] inline auto find_next(usize index) const noexcept -> Option<usize> {
+            return bits::find_next_set(_words.data(), _words.size(), index);
+        }
+
+        template<typename F>
+        inline auto for_each_set(F&& function) const noexcept -> void {
+            for(usize index = 0; index < _words.size(); ++index) {
+                bits::for_each_set_bit(_words[index], [&function, index](const usize bit) {
+                    function(index * bits::word_bits + bit);
+                });
+            }
+        }
+
+        inline auto and_not(const DynamicBitset& other) noexcept -> DynamicBitset& {
+            assert_true(_size == other._size);
+            bits::and_not_words(_words.data(), other._words.data(), _words.size());
+            return *this;
+        }
+
+        [[nodiscard]] inline auto get_words() noexcept -> Slice<u64> {
+            return {_words.data(), _words.size() * sizeof(u64)};
+        }
+
+        [[nodiscard]] inline auto get_words() const noexcept -> Slice<const u64> {
+            return {_words.data(), _words.size() * sizeof(u64)};
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _size;
+        }
+
+        [[nodiscard]] inline auto operator[](usize index) const noexcept -> bool {
+            return test(index);
+        }
+
+        inline auto operator&=(const DynamicBitset& other) noexcept -> DynamicBitset& {
+            assert_true(_size == other._size);
+            bits::and_words(_words.data(), other._words.data(), _words.size());
+            return *this;
+        }
+
+        inline auto operator|=(const DynamicBitset& other) noexcept -> DynamicBitset& {
+            assert_true(_size == other._size);
+            bits::or_words(_words.data(), other._words.data(), _words.size());
+            return *this;
+        }
+
+        inline auto operator^=(const DynamicBitset& other) noexcept -> DynamicBitset& {
+            assert_true(_size == other._size);
+            bits::xor_words(_words.data(), other._words.data(), _words.size());
+            return *this;
+        }
+
+        [[nodiscard]] inline auto operator&(const DynamicBitset& other) const noexcept -> DynamicBitset {
+            auto result = *this;
+            return result &= other;
+        }
+
+        [[nodiscard]] inline auto operator|(const DynamicBitset& other) const noexcept -> DynamicBitset {
+            auto result = *this;
+            return result |= other;
+        }
+
+        [[nodiscard]] inline auto operator^(const DynamicBitset& other) const noexcept -> DynamicBitset {
+            auto result = *this;
+            return result ^= other;
+        }
+
+        [[nodiscard]] inline auto operator~() const noexcept -> DynamicBitset {
+            auto result = *this;
+            result.flip_all();
+            return result;
+        }
+
+        [[nodiscard]] inline auto operator==(const DynamicBitset& other) const noexcept -> bool {
+            return _size == other._size && _words == other._words;
+        }
+
+        [[nodiscard]] inline auto operator!=(const DynamicBitset& other) const noexcept -> bool {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * Acceleration structure for O(1) rank and O(log n) select queries
+     * over the words of a bitset. Stores one cumulative count per
+     * block of 512 bits (one cache line of words).
+     * The index only keeps a view of the given words, so it has to be rebuilt
+     * whenever the underlying bitset is modified or reallocated.
+     */
+    class RankSelectIndex final {
+        static constexpr usize block_words = 8;
+
+        Slice<const u64> _words;
+        std::vector<u64> _blocks;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(RankSelectIndex, RankSelectIndex, inline)
+
+        explicit RankSelectIndex(Slice<const u64> words) noexcept :
+                _words {words},
+                _blocks {} {
+            const auto word_count = _words.get_count();
+            _blocks.reserve(word_count / block_words + 2);
+            u64 total = 0;
+            for(usize index = 0; index < word_count; index += block_words) {
+                _blocks.push_back(total);
+                total += bits::popcount_words(_words.get_data() + index, std::min(block_words, word_count - index));
+            }
+            _blocks.push_back(total);
+        }
+
+        ~RankSelectIndex() noexcept = default;
+
+        /**
+         * @return The total number of set bits.
+         */
+        [[nodiscard]] inline auto get_count() const noexcept -> usize {
+            return _blocks.back();
+        }
+
+        /**
+         * @param index The index of the bit up to which to count, must be within the bitset.
+         * @return The number of set bits before the given index (exclusive).
+         */
+        [[nodiscard]] inline auto rank(usize index) const noexcept -> usize {
+            const auto word_index = index / bits::word_bits;
+            const auto block_index = word_index / block_words;
+            const auto* words = _words.get_data();
+            auto result = static_cast<usize>(_blocks[block_index]);
+            result += bits::popcount_words(words + block_index * block_words, word_index - block_index * block_words);
+            const auto bit = index % bits::word_bits;
+            if(bit != 0) {
+                result += bits::popcount(words[word_index] & ((u64 {1} << bit) - 1));
+            }
+            return result;
+        }
+
+        /**
+         * @param rank The zero-based rank of the set bit to find.
+         * @return The index of the set bit with the given rank, if there are enough set bits.
+         */
+        [[nodiscard]] inline auto select(usize rank) const noexcept -> Option<usize> {
+            if(rank >= get_count()) {
+                return {};
+            }
+            // Find the last block whose cumulative count is <= rank
+            const auto block = std::upper_bound(_blocks.cbegin(), _blocks.cend(), static_cast<u64>(rank)) - 1;
+            auto remaining = rank - static_cast<usize>(*block);
+            const auto* words = _words.get_data();
+            auto word_index = static_cast<usize>(block - _blocks.cbegin()) * block_words;
+            while(true) {
+                const auto count = bits::popcount(words[word_index]);
+                if(remaining < count) {
+                    return word_index * bits::word_bits + bits::select_in_word(words[word_index], remaining);
+                }
+                remaining -= count;
+                ++word_index;
+            }
+        }
+    };
+}// namespace kstd
+
+KSTD_HASH_T(KSTD_TEMPLATE((kstd::usize SIZE)), (kstd::Bitset<SIZE>),
+            kstd::hash_range(value._words.cbegin(), value._words.cend()))
+KSTD_HASH((kstd::DynamicBitset), kstd::hash_range(value._words.cbegin(), value._words.cend()))
@@ -0,0 +1,299 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fmt/format.h>
+#include <vector>
+
+#include "assert.hpp"
+#include "bitset.hpp"
+#include "defaults.hpp"
+#include "hash.hpp"
+#include "result.hpp"
+#include "slice.hpp"
+#include "types.hpp"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif// __AVX2__
+
+namespace kstd {
+    /**
+     * A split block Bloom filter.
+     * Every key maps to a single 256-bit block (so a lookup touches exactly one
+     * cache line) and sets one bit in each of the block's eight 32-bit lanes.
+     * The high half of a single 64-bit hash selects the block, the low half is
+     * multiplied with a different odd salt per lane to select the eight bits,
+     * so with AVX2 all lanes are computed and probed with a handful of vector
+     * instructions.
+     */
+    class BloomFilter final {
+        public:
+        static constexpr usize block_bits = 256;
+        // Number of bits set per key, one in each 32-bit lane of the block
+        static constexpr usize probes_per_key = 8;
+
+        struct alignas(32) Block final {
+            std::array<u64, 4> words;
+        };
+
+        private:
+        static constexpr u32 magic = 0x4D4C424B;// "KBLM"
+        static constexpr u32 version = 1;
+        // Odd multipliers which derive the bit of every lane from the low half of the hash
+        static constexpr std::array<u32, probes_per_key> salts {0x47B6137B, 0x44974D91, 0x8824AD5B, 0xA2B7289D,
+                                                                0x705495C7, 0x2DF1424B, 0x9EFC4947, 0x5C6BFB31};
+
+        struct Header final {
+            u32 magic;
+            u32 version;
+            u64 block_count;
+            std::array<u64, 2> reserved;
+        };
+
+        static_assert(sizeof(Header) == sizeof(Block), "Header must keep the blocks aligned");
+
+        std::vector<Block> _blocks;
+
+        explicit BloomFilter(std::vector<Block> blocks) noexcept :
+                _blocks {std::move(blocks)} {
+        }
+
+        public:
+        [[nodiscard]] static inline auto get_block_index(u64 hash, usize block_count) noexcept -> usize {
+            return static_cast<usize>(((hash >> 32) * static_cast<u64>(block_count)) >> 32);
+        }
+
+        static inline auto insert_into(Block& block, u64 hash) noexcept -> void {
+            const auto key = static_cast<u32>(hash);
+            for(usize lane = 0; lane < probes_per_key; ++lane) {
+                const auto bit = (key * salts[lane]) >> 27;
+                block.words[lane >> 1] |= u64 {1} << (((lane & 1) << 5) + bit);
+            }
+        }
+
+        [[nodiscard]] static inline auto contains_in(const Block& block, u64 hash) noexcept -> bool {
+            const auto key = static_cast<u32>(hash);
+#ifdef __AVX2__
+            const auto lane_salts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(salts.data()));
+            const auto positions = _mm256_srli_epi32(
+                    _mm256_mullo_epi32(_mm256_set1_epi32(static_cast<i32>(key)), lane_salts), 27);
+            const auto mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), positions);
+            const auto words = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.words.data()));
+            return _mm256_testc_si256(words, mask) != 0;
+#else
+            for(usize lane = 0; lane < probes_per_key; ++lane) {
+                const auto bit = (key * salts[lane]) >> 27;
+                if((block.words[lane >> 1] & (u64 {1} << (((lane & 1) << 5) + bit))) == 0) {
+                    return false;
+                }
+            }
+            return true;
+#endif// __AVX2__
+        }
+
+        KSTD_DEFAULT_MOVE_COPY(BloomFilter, BloomFilter, inline)
+
+        /**
+         * @param expected_count The number of keys the filter is sized for.
+         * @param false_positive_rate The desired false positive rate at the expected number of keys,
+         *                            must be in the open interval (0, 1).
+         */
+        explicit BloomFilter(usize expected_count, f64 false_positive_rate = 0.01) :
+                _blocks {} {
+            assert_true(false_positive_rate > 0.0 && false_positive_rate < 1.0);
+            // Clamp in release builds, since log of 0, NaN or a rate >= 1 would produce a bogus size
+            if(!(false_positive_rate > 0.0)) {
+                false_positive_rate = 1e-12;
+            }
+            else if(false_positive_rate >= 1.0) {
+                false_positive_rate = 0.5;
+            }
+            constexpr auto ln2_squared = 0.4804530139182014;
+            const auto bits = -static_cast<f64>(expected_count > 0 ? expected_count : 1) *
+                              std::log(false_positive_rate) / ln2_squared;
+            const auto block_count = static_cast<usize>(std::ceil(bits / static_cast<f64>(block_bits)));
+            _blocks.resize(block_count > 0 ? block_count : 1, Block {});
+        }
+
+        ~BloomFilter() noexcept = default;
+
+        /**
+         * @return A filter of the given number of blocks.
+         */
+        [[nodiscard]] static inline auto with_block_count(usize block_count) -> BloomFilter {
+            return BloomFilter {std::vector<Block>(block_count > 0 ? block_count : 1, Block {})};
+        }
+
+        [[nodiscard]] inline auto get_block_count() const noexcept -> usize {
+            return _blocks.size();
+        }
+
+        [[nodiscard]] inline auto get_blocks() const noexcept -> Slice<const Block> {
+            return {_blocks.data(), _blocks.size() * sizeof(Block)};
+        }
+
+        inline auto insert_hash(u64 hash) noexcept -> void {
+            insert_into(_blocks[get_block_index(hash, _blocks.size())], hash);
+        }
+
+        [[nodiscard]] inline auto contains_hash(u64 hash) const noexcept -> bool {
+            return contains_in(_blocks[get_block_index(hash, _blocks.size())], hash);
+        }
+
+        template<typename T>
+        inline auto insert(const T& value) noexcept -> void {
+            insert_hash(mix_hash64(hash(value)));
+        }
+
+        /**
+         * @return False if the value was definitely never inserted, true if it probably was.
+         */
+        template<typename T>
+        [[nodiscard]] inline auto contains(const T& value) const noexcept -> bool {
+            return contains_hash(mix_hash64(hash(value)));
+        }
+
+        inline auto clear() noexcept -> void {
+            std::fill(_blocks.begin(), _blocks.end(), Block {});
+        }
+
+        /**
+         * Adds all keys of the given filter to this filter.
+         * Both filters need to have the same number of blocks.
+         */
+        [[nodiscard]] inline auto merge(const BloomFilter& other) noexcept -> Result<void> {
+            if(other._blocks.size() != _blocks.size()) {
+                return Error {fmt::format("Cannot merge Bloom filters with {} and {} blocks", _blocks.size(),
+                                          other._blocks.size())};
+            }
+            bits::or_words(_blocks.data()->words.data(), other._blocks.data()->words.data(), _blocks.size() << 2);
+            return {};
+        }
+
+        [[nodiscard]] inline auto get_serialized_size() const noexcept -> usize {
+            return sizeof(Header) + _blocks.size() * sizeof(Block);
+        }
+
+        /**
+         * Writes the filter in native byte order into the given buffer.
+         * If the buffer is 32-byte aligned (e.g. a memory mapped page), the
+         * written bytes can be probed in place through kstd::BloomFilterView.
+         *
+         * @return The number of bytes written.
+         */
+        [[nodiscard]] inline auto serialize(Slice<u8> buffer) const noexcept -> Result<usize> {
+            const auto size = get_serialized_size();
+            if(buffer.get_size() < size) {
+                return Error {fmt::format("Buffer of {} bytes is too small, {} bytes are required",
+                                          buffer.get_size(), size)};
+            }
+            const Header header {magic, version, _blocks.size(), {}};
+            std::memcpy(buffer.get_data(), &header, sizeof(Header));
+            std::memcpy(buffer.get_data() + sizeof(Header), _blocks.data(), _blocks.size() * sizeof(Block));
+            return size;
+        }
+
+        /**
+         * @return A filter holding a copy of the blocks stored in the given buffer.
+         */
+        [[nodiscard]] static inline auto deserialize(Slice<const u8> buffer) -> Result<BloomFilter> {
+            auto block_count = read_header(buffer);
+            if(!block_count) {
+                return block_count.template forward<BloomFilter>();
+            }
+            std::vector<Block> blocks(*block_count);
+            std::memcpy(static_cast<void*>(blocks.data()), buffer.get_data() + sizeof(Header),
+                        blocks.size() * sizeof(Block));
+            return BloomFilter {std::move(blocks)};
+        }
+
+        /**
+         * Validates the header of a serialized filter.
+         *
+         * @return The number of blocks following the header.
+         */
+        [[nodiscard]] static inline auto read_header(Slice<const u8> buffer) noexcept -> Result<usize> {
+            if(buffer.get_size() < sizeof(Header)) {
+                return Error {std::string {"Buffer is too small to contain a Bloom filter"}};
+            }
+            Header header {};
+            std::memcpy(&header, buffer.get_data(), sizeof(Header));
+            if(header.magic != magic || header.version != version) {
+                return Error {std::string {"Buffer does not contain a compatible Bloom filter"}};
+            }
+            if(header.block_count == 0 || (buffer.get_size() - sizeof(Header)) / sizeof(Block) < header.block_count) {
+                return Error {fmt::format("Buffer is truncated, expected {} blocks", header.block_count)};
+            }
+            return static_cast<usize>(header.block_count);
+        }
+    };
+
+    /**
+     * Read-only view of a serialized kstd::BloomFilter which probes the blocks in place.
+     */
+    class BloomFilterView final {
+        Slice<const BloomFilter::Block> _blocks;
+
+        explicit BloomFilterView(Slice<const BloomFilter::Block> blocks) noexcept :
+                _blocks {blocks} {
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(BloomFilterView, BloomFilterView, constexpr)
+
+        BloomFilterView(const BloomFilter& filter) noexcept :// NOLINT
+                _blocks {filter.get_blocks()} {
+        }
+
+        ~BloomFilterView() noexcept = default;
+
+        /**
+         * @param buffer A buffer written by BloomFilter::serialize, which has to be 32-byte aligned.
+         */
+        [[nodiscard]] static inline auto from_bytes(Slice<const u8> buffer) noexcept -> Result<BloomFilterView> {
+            if((reinterpret_cast<usize>(buffer.get_data()) & (alignof(BloomFilter::Block) - 1)) != 0) {
+                return Error {std::string {"Serialized Bloom filter must be 32-byte aligned"}};
+            }
+            auto block_count = BloomFilter::read_header(buffer);
+            if(!block_count) {
+                return block_count.template forward<BloomFilterView>();
+            }
+            const auto* blocks = reinterpret_cast<const BloomFilter::Block*>(buffer.get_data() + sizeof(BloomFilter::Block));
+            return BloomFilterView {{blocks, *block_count * sizeof(BloomFilter::Block)}};
+        }
+
+        [[nodiscard]] inline auto get_block_count() const noexcept -> usize {
+            return _blocks.get_count();
+        }
+
+        [[nodiscard]] inline auto contains_hash(u64 hash) const noexcept -> bool {
+            return BloomFilter::contains_in(_blocks[BloomFilter::get_block_index(hash, _blocks.get_count())], hash);
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto contains(const T& value) const noexcept -> bool {
+            return contains_hash(mix_hash64(hash(value)));
+        }
+    };
+}// namespace kstd
@@ -0,0 +1,788 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "assert.hpp"
+#include "defaults.hpp"
+#include "hash.hpp"
+#include "option.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    /**
+     * Hit, miss and eviction counters of a cache.
+     */
+    struct CacheStats final {
+        using Self = CacheStats;
+
+        u64 hits;
+        u64 misses;
+        u64 evictions;
+
+        [[nodiscard]] constexpr auto get_lookups() const noexcept -> u64 {
+            return hits + misses;
+        }
+
+        [[nodiscard]] constexpr auto get_hit_ratio() const noexcept -> f64 {
+            const auto lookups = get_lookups();
+            return lookups == 0 ? 0.0 : static_cast<f64>(hits) / static_cast<f64>(lookups);
+        }
+
+        [[nodiscard]] constexpr auto operator+(const Self& other) const noexcept -> Self {
+            return {hits + other.hits, misses + other.misses, evictions + other.evictions};
+        }
+    };
+
+    /**
+     * Open addressing index which maps hashes to node indices of a cache slab.
+     * The index only stores 32-bit node indices and hash fragments, keys are
+     * compared by the caller through the node index.
+     */
+    class CacheIndex final {
+        public:
+        static constexpr u32 invalid = std::numeric_limits<u32>::max();
+
+        private:
+        struct Bucket final {
+            u32 node;
+            u32 hash;
+        };
+
+        std::vector<Bucket> _buckets;
+        usize _mask;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(CacheIndex, CacheIndex, inline)
+
+        /**
+         * @param capacity The maximum number of nodes which will be indexed at the same time.
+         */
+        explicit CacheIndex(usize capacity) :
+                _buckets {},
+                _mask {0} {
+            usize bucket_count = 8;
+            while(bucket_count < (capacity << 1)) {
+                bucket_count <<= 1;
+            }
+            _buckets.resize(bucket_count, Bucket {invalid, 0});
+            _mask = bucket_count - 1;
+        }
+
+        ~CacheIndex() noexcept = default;
+
+        /**
+         * @tparam F The type of the predicate which compares a candidate node with the searched key.
+         * @return The index of the first node with the given hash which matches the predicate.
+         */
+        template<typename F>
+        [[nodiscard]] inline auto find(usize hash, F&& matches) const noexcept -> Option<u32> {
+            for(auto index = hash & _mask;; index = (index + 1) & _mask) {
+                const auto& bucket = _buckets[index];
+                if(bucket.node == invalid) {
+                    return {};
+                }
+                if(bucket.hash == static_cast<u32>(hash) && matches(bucket.node)) {
+                    return bucket.node;
+                }
+            }
+        }
+
+        inline auto insert(usize hash, u32 node) noexcept -> void {
+            auto index = hash & _mask;
+            while(_buckets[index].node != invalid) {
+                index = (index + 1) & _mask;
+            }
+            _buckets[index] = {node, static_cast<u32>(hash)};
+        }
+
+        inline auto erase(usize hash, u32 node) noexcept -> void {
+            auto index = hash & _mask;
+            while(_buckets[index].node != node) {
+                assert_true(_buckets[index].node != invalid);
+                index = (index + 1) & _mask;
+            }
+            _buckets[index].node = invalid;
+            // Shift back the rest of the probe sequence instead of leaving a tombstone
+            for(auto next = (index + 1) & _mask; _buckets[next].node != invalid; next = (next + 1) & _mask) {
+                const auto home = _buckets[next].hash & _mask;
+                if(((next - home) & _mask) < ((next - index) & _mask)) {
+                    continue;
+                }
+                _buckets[index] = _buckets[next];
+                _buckets[next].node = invalid;
+                index = next;
+            }
+        }
+
+        inline auto clear() noexcept -> void {
+            for(auto& bucket : _buckets) {
+                bucket.node = invalid;
+            }
+        }
+    };
+
+    /**
+     * A least recently used cache with a fixed capacity.
+     * All entries live in a single slab allocated up front and are linked
+     * into the recency list by 32-bit indices, so neither lookups nor
+     * insertions or evictions allocate memory.
+     *
+     * @tparam K The type of the keys.
+     * @tparam V The type of the values.
+     * @tparam HASH The hash function used for the keys.
+     * @tparam EQUAL The equality function used for the keys.
+     */
+    template<typename K, typename V, typename HASH = Hash<K>, typename EQUAL = std::equal_to<K>>
+    class LruCache final {
+        public:
+        using KeyType = K;
+        using ValueType = V;
+        using Self = LruCache<KeyType, ValueType, HASH, EQUAL>;
+        using Entry = std::pair<KeyType, ValueType>;
+
+        private:
+        static constexpr u32 invalid = CacheIndex::invalid;
+
+        struct Node final {
+            usize hash;
+            u32 previous;
+            u32 next;
+            alignas(Entry) u8 storage[sizeof(Entry)];
+
+            [[nodiscard]] inline auto get() noexcept -> Entry& {
+                return *std::launder(reinterpret_cast<Entry*>(storage));
+            }
+        };
+
+        std::unique_ptr<Node[]> _nodes;
+        CacheIndex _index;
+        usize _capacity;
+        usize _size;
+        u32 _used;
+        u32 _free;
+        u32 _head;
+        u32 _tail;
+        CacheStats _stats;
+        HASH _hash;
+        EQUAL _equal;
+
+        [[nodiscard]] inline auto get_hash(const KeyType& key) const noexcept -> usize {
+            return mix_hash(_hash(key));
+        }
+
+        [[nodiscard]] inline auto find_node(usize hash, const KeyType& key) const noexcept -> Option<u32> {
+            return _index.find(hash, [&](u32 node) {
+                return _nodes[node].hash == hash && _equal(_nodes[node].get().first, key);
+            });
+        }
+
+        inline auto unlink(u32 node) noexcept -> void {
+            auto& current = _nodes[node];
+            if(current.previous != invalid) {
+                _nodes[current.previous].next = current.next;
+            }
+            else {
+                _head = current.next;
+            }
+            if(current.next != invalid) {
+                _nodes[current.next].previous = current.previous;
+            }
+            else {
+                _tail = current.previous;
+            }
+        }
+
+        inline auto push_front(u32 node) noexcept -> void {
+            auto& current = _nodes[node];
+            current.previous = invalid;
+            current.next = _head;
+            if(_head != invalid) {
+                _nodes[_head].previous = node;
+            }
+            _head = node;
+            if(_tail == invalid) {
+                _tail = node;
+            }
+        }
+
+        inline auto touch(u32 node) noexcept -> void {
+            if(_head != node) {
+                unlink(node);
+                push_front(node);
+            }
+        }
+
+        inline auto remove(u32 node) noexcept -> Entry {
+            auto& current = _nodes[node];
+            unlink(node);
+            _index.erase(current.hash, node);
+            auto entry = std::move(current.get());
+            current.get().~Entry();
+            --_size;
+            return entry;
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(LruCache, Self, constexpr)
+
+        /**
+         * @param capacity The maximum number of entries, must be greater than zero.
+         */
+        explicit LruCache(usize capacity, HASH hash = HASH {}, EQUAL equal = EQUAL {}) :
+                _nodes {std::make_unique<Node[]>(capacity)},
+                _index {capacity},
+                _capacity {capacity},
+                _size {0},
+                _used {0},
+                _free {invalid},
+                _head {invalid},
+                _tail {invalid},
+                _stats {},
+                _hash {std::move(hash)},
+                _equal {std::move(equal)} {
+            assert_true(capacity > 0 && capacity < invalid);
+        }
+
+        ~LruCache() noexcept {
+            clear();
+        }
+
+        [[nodiscard]] inline auto get_capacity() const noexcept -> usize {
+            return _capacity;
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _size;
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return _size == 0;
+        }
+
+        [[nodiscard]] inline auto get_stats() const noexcept -> CacheStats {
+            return _stats;
+        }
+
+        inline auto reset_stats() noexcept -> void {
+            _stats = {};
+        }
+
+        /**
+         * Looks up the given key and marks it as most recently used.
+         *
+         * @return A reference to the cached value, valid until the entry is evicted.
+         */
+        [[nodiscard]] inline auto get(const KeyType& key) noexcept -> Option<ValueType&> {
+            const auto node = find_node(get_hash(key), key);
+            if(!node) {
+                ++_stats.misses;
+                return {};
+            }
+            ++_stats.hits;
+            touch(*node);
+            return _nodes[*node].get().second;
+        }
+
+        /**
+         * Looks up the given key without changing its recency or the statistics.
+         */
+        [[nodiscard]] inline auto peek(const KeyType& key) const noexcept -> Option<const ValueType&> {
+            const auto node = find_node(get_hash(key), key);
+            if(!node) {
+                return {};
+            }
+            return _nodes[*node].get().second;
+        }
+
+        [[nodiscard]] inline auto contains(const KeyType& key) const noexcept -> bool {
+            return find_node(get_hash(key), key).has_value();
+        }
+
+        /**
+         * Inserts or replaces the given entry and marks it as most recently used.
+         *
+         * @return The least recently used entry, if it had to be evicted to make room.
+         */
+        inline auto put(KeyType key, ValueType value) -> Option<Entry> {
+            const auto hash = get_hash(key);
+            if(const auto node = find_node(hash, key)) {
+                _nodes[*node].get().second = std::move(value);
+                touch(*node);
+                return {};
+            }
+            Option<Entry> evicted {};
+            u32 node = invalid;
+            if(_size == _capacity) {
+                node = _tail;
+                evicted = remove(node);
+                ++_stats.evictions;
+            }
+            else if(_free != invalid) {
+                node = std::exchange(_free, _nodes[_free].next);
+            }
+            else {
+                node = _used++;
+            }
+            auto& current = _nodes[node];
+            new(current.storage) Entry(std::move(key), std::move(value));
+            current.hash = hash;
+            _index.insert(hash, node);
+            push_front(node);
+            ++_size;
+            return evicted;
+        }
+
+        /**
+         * @return The removed value, if the key was present.
+         */
+        inline auto erase(const KeyType& key) noexcept -> Option<ValueType> {
+            const auto node = find_node(get_hash(key), key);
+            if(!node) {
+                return {};
+            }
+            auto entry = remove(*node);
+            _nodes[*node].next = std::exchange(_free, *node);
+            return std::move(entry.second);
+        }
+
+        inline auto clear() noexcept -> void {
+            for(auto node = _head; node != invalid; node = _nodes[node].next) {
+                _nodes[node].get().~Entry();
+            }
+            _index.clear();
+            _size = 0;
+            _used = 0;
+            _free = invalid;
+            _head = invalid;
+            _tail = invalid;
+        }
+
+        /**
+         * Invokes the given function for every entry, from the most to the least recently used one.
+         */
+        template<typename F>
+        inline auto for_each(F&& function) const -> void {
+            for(auto node = _head; node != invalid; node = _nodes[node].next) {
+                const auto& entry = _nodes[node].get();
+                function(entry.first, entry.second);
+            }
+        }
+    };
+
+    /**
+     * A cache with a fixed capacity which uses the SIEVE variant of the CLOCK algorithm.
+     * Hits only set a reference bit instead of relinking a list. Entries are kept
+     * in insertion order and the hand moves from the oldest towards the newest
+     * entry, clearing reference bits as it goes. New entries are inserted at the
+     * newest end right in front of the hand, so a scan over many cold keys keeps
+     * evicting its own entries, while entries which were hit before the scan are
+     * only visited again once the hand wraps around.
+     *
+     * @tparam K The type of the keys.
+     * @tparam V The type of the values.
+     * @tparam HASH The hash function used for the keys.
+     * @tparam EQUAL The equality function used for the keys.
+     */
+    template<typename K, typename V, typename HASH = Hash<K>, typename EQUAL = std::equal_to<K>>
+    class ClockCache final {
+        public:
+        using KeyType = K;
+        using ValueType = V;
+        using Self = ClockCache<KeyType, ValueType, HASH, EQUAL>;
+        using Entry = std::pair<KeyType, ValueType>;
+
+        private:
+        static constexpr u32 invalid = CacheIndex::invalid;
+
+        struct Node final {
+            usize hash;
+            u32 previous;// Towards the newest entry
+            u32 next;    // Towards the oldest entry
+            bool referenced;
+            alignas(Entry) u8 storage[sizeof(Entry)];
+
+            [[nodiscard]] inline auto get() noexcept -> Entry& {
+                return *std::launder(reinterpret_cast<Entry*>(storage));
+            }
+        };
+
+        std::unique_ptr<Node[]> _nodes;
+        CacheIndex _index;
+        usize _capacity;
+        usize _size;
+        u32 _used;
+        u32 _free;
+        u32 _head;
+        u32 _tail;
+        u32 _hand;
+        CacheStats _stats;
+        HASH _hash;
+        EQUAL _equal;
+
+        [[nodiscard]] inline auto get_hash(const KeyType& key) const noexcept -> usize {
+            return mix_hash(_hash(key));
+        }
+
+        [[nodiscard]] inline auto find_node(usize hash, const KeyType& key) const noexcept -> Option<u32> {
+            return _index.find(hash, [&](u32 node) {
+                return _nodes[node].hash == hash && _equal(_nodes[node].get().first, key);
+            });
+        }
+
+        inline auto unlink(u32 node) noexcept -> void {
+            auto& current = _nodes[node];
+            if(current.previous != invalid) {
+                _nodes[current.previous].next = current.next;
+            }
+            else {
+                _head = current.next;
+            }
+            if(current.next != invalid) {
+                _nodes[current.next].previous = current.previous;
+            }
+            else {
+                _tail = current.previous;
+            }
+        }
+
+        inline auto push_front(u32 node) noexcept -> void {
+            auto& current = _nodes[node];
+            current.previous = invalid;
+            current.next = _head;
+            if(_head != invalid) {
+                _nodes[_head].previous = node;
+            }
+            _head = node;
+            if(_tail == invalid) {
+                _tail = node;
+            }
+        }
+
+        inline auto remove(u32 node) noexcept -> Entry {
+            auto& current = _nodes[node];
+            if(_hand == node) {
+                _hand = current.previous;// Wraps around to the tail once it passed the newest entry
+            }
+            unlink(node);
+            _index.erase(current.hash, node);
+            auto entry = std::move(current.get());
+            current.get().~Entry();
+            --_size;
+            return entry;
+        }
+
+        /**
+         * Advances the hand towards newer entries until it finds an unreferenced one,
+         * giving every referenced entry it passes a second chance.
+         */
+        [[nodiscard]] inline auto find_victim() noexcept -> u32 {
+            auto node = _hand != invalid ? _hand : _tail;
+            while(_nodes[node].referenced) {
+                _nodes[node].referenced = false;
+                node = _nodes[node].previous != invalid ? _nodes[node].previous : _tail;
+            }
+            _hand = node;
+            return node;
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(ClockCache, Self, constexpr)
+
+        /**
+         * @param capacity The maximum number of entries, must be greater than zero.
+         */
+        explicit ClockCache(usize capacity, HASH hash = HASH {}, EQUAL equal = EQUAL {}) :
+                _nodes {std::make_unique<Node[]>(capacity)},
+                _index {capacity},
+                _capacity {capacity},
+                _size {0},
+                _used {0},
+                _free {invalid},
+                _head {invalid},
+                _tail {invalid},
+                _hand {invalid},
+                _stats {},
+                _hash {std::move(hash)},
+                _equal {std::move(equal)} {
+            assert_true(capacity > 0 && capacity < invalid);
+        }
+
+        ~ClockCache() noexcept {
+            clear();
+        }
+
+        [[nodiscard]] inline auto get_capacity() const noexcept -> usize {
+            return _capacity;
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _size;
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return _size == 0;
+        }
+
+        [[nodiscard]] inline auto get_stats() const noexcept -> CacheStats {
+            return _stats;
+        }
+
+        inline auto reset_stats() noexcept -> void {
+            _stats = {};
+        }
+
+        /**
+         * Looks up the given key and marks it as referenced.
+         *
+         * @return A reference to the cached value, valid until the entry is evicted.
+         */
+        [[nodiscard]] inline auto get(const KeyType& key) noexcept -> Option<ValueType&> {
+            const auto node = find_node(get_hash(key), key);
+            if(!node) {
+                ++_stats.misses;
+                return {};
+            }
+            ++_stats.hits;
+            auto& current = _nodes[*node];
+            current.referenced = true;
+            return current.get().second;
+        }
+
+        /**
+         * Looks up the given key without marking it as referenced or changing the statistics.
+         */
+        [[nodiscard]] inline auto peek(const KeyType& key) const noexcept -> Option<const ValueType&> {
+            const auto node = find_node(get_hash(key), key);
+            if(!node) {
+                return {};
+            }
+            return _nodes[*node].get().second;
+        }
+
+        [[nodiscard]] inline auto contains(const KeyType& key) const noexcept -> bool {
+            return find_node(get_hash(key), key).has_value();
+        }
+
+        /**
+         * Inserts or replaces the given entry.
+         *
+         * @return The entry which had to be evicted to make room, if any.
+         */
+        inline auto put(KeyType key, ValueType value) -> Option<Entry> {
+            const auto hash = get_hash(key);
+            if(const auto node = find_node(hash, key)) {
+                auto& current = _nodes[*node];
+                current.get().second = std::move(value);
+                current.referenced = true;
+                return {};
+            }
+            Option<Entry> evicted {};
+            u32 node = invalid;
+            if(_size == _capacity) {
+                node = find_victim();
+                evicted = remove(node);
+                ++_stats.evictions;
+            }
+            else if(_free != invalid) {
+                node = std::exchange(_free, _nodes[_free].next);
+            }
+            else {
+                node = _used++;
+            }
+            auto& current = _nodes[node];
+            new(current.storage) Entry(std::move(key), std::move(value));
+            current.hash = hash;
+            current.referenced = false;
+            _index.insert(hash, node);
+            push_front(node);
+            ++_size;
+            return evicted;
+        }
+
+        /**
+         * @return The removed value, if the key was present.
+         */
+        inline auto erase(const KeyType& key) noexcept -> Option<ValueType> {
+            const auto node = find_node(get_hash(key), key);
+            if(!node) {
+                return {};
+            }
+            auto entry = remove(*node);
+            _nodes[*node].next = std::exchange(_free, *node);
+            return std::move(entry.second);
+        }
+
+        inline auto clear() noexcept -> void {
+            for(auto node = _head; node != invalid; node = _nodes[node].next) {
+                _nodes[node].get().~Entry();
+            }
+            _index.clear();
+            _size = 0;
+            _used = 0;
+            _free = invalid;
+            _head = invalid;
+            _tail = invalid;
+            _hand = invalid;
+        }
+
+        /**
+         * Invokes the given function for every entry, from the newest to the oldest one.
+         */
+        template<typename F>
+        inline auto for_each(F&& function) const -> void {
+            for(auto node = _head; node != invalid; node = _nodes[node].next) {
+                const auto& entry = _nodes[node].get();
+                function(entry.first, entry.second);
+            }
+        }
+    };
+
+    /**
+     * Thread safe wrapper which distributes keys across independently locked caches.
+     * Since entries may be evicted by other threads at any time, lookups return
+     * copies of the cached values instead of references.
+     *
+     * @tparam CACHE The cache type used for every shard, e.g. kstd::LruCache or kstd::ClockCache.
+     * @tparam HASH The hash function used for selecting the shard of a key.
+     */
+    template<typename CACHE, typename HASH = Hash<typename CACHE::KeyType>>
+    class ShardedCache final {
+        public:
+        using CacheType = CACHE;
+        using KeyType = typename CacheType::KeyType;
+        using ValueType = typename CacheType::ValueType;
+        using Entry = typename CacheType::Entry;
+        using Self = ShardedCache<CacheType, HASH>;
+
+        private:
+        struct alignas(64) Shard final {
+            std::mutex mutex;
+            CacheType cache;
+
+            explicit Shard(usize capacity) :
+                    mutex {},
+                    cache {capacity} {
+            }
+        };
+
+        std::vector<std::unique_ptr<Shard>> _shards;
+        usize _shard_shift;
+        HASH _hash;
+
+        [[nodiscard]] inline auto get_shard(const KeyType& key) const noexcept -> Shard& {
+            constexpr usize hash_bits = sizeof(usize) << 3;
+            const auto hash = mix_hash(_hash(key));
+            return *_shards[_shard_shift == hash_bits ? 0 : hash >> _shard_shift];
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(ShardedCache, Self, constexpr)
+
+        /**
+         * @param capacity The total capacity, split evenly across all shards.
+         * @param shard_count The number of shards, rounded up to a power of two.
+         */
+        explicit ShardedCache(usize capacity, usize shard_count = 16, HASH hash = HASH {}) :
+                _shards {},
+                _shard_shift {sizeof(usize) << 3},
+                _hash {std::move(hash)} {
+            usize count = 1;
+            while(count < shard_count) {
+                count <<= 1;
+                --_shard_shift;
+            }
+            const auto per_shard = (capacity + count - 1) / count;
+            _shards.reserve(count);
+            for(usize index = 0; index < count; ++index) {
+                _shards.push_back(std::make_unique<Shard>(per_shard > 0 ? per_shard : 1));
+            }
+        }
+
+        ~ShardedCache() noexcept = default;
+
+        [[nodiscard]] inline auto get_shard_count() const noexcept -> usize {
+            return _shards.size();
+        }
+
+        [[nodiscard]] inline auto get(const KeyType& key) -> Option<ValueType> {
+            auto& shard = get_shard(key);
+            std::lock_guard lock {shard.mutex};
+            if(auto value = shard.cache.get(key)) {
+                return *value;
+            }
+            return {};
+        }
+
+        [[nodiscard]] inline auto contains(const KeyType& key) const -> bool {
+            auto& shard = get_shard(key);
+            std::lock_guard lock {shard.mutex};
+            return shard.cache.contains(key);
+        }
+
+        inline auto put(KeyType key, ValueType value) -> Option<Entry> {
+            auto& shard = get_shard(key);
+            std::lock_guard lock {shard.mutex};
+            return shard.cache.put(std::move(key), std::move(value));
+        }
+
+        inline auto erase(const KeyType& key) -> Option<ValueType> {
+            auto& shard = get_shard(key);
+            std::lock_guard lock {shard.mutex};
+            return shard.cache.erase(key);
+        }
+
+        inline auto clear() -> void {
+            for(auto& shard : _shards) {
+                std::lock_guard lock {shard->mutex};
+                shard->cache.clear();
+            }
+        }
+
+        [[nodiscard]] inline auto get_size() const -> usize {
+            usize size = 0;
+            for(const auto& shard : _shards) {
+                std::lock_guard lock {shard->mutex};
+                size += shard->cache.get_size();
+            }
+            return size;
+        }
+
+        /**
+         * @return The statistics of all shards combined.
+         */
+        [[nodiscard]] inline auto get_stats() const -> CacheStats {
+            CacheStats stats {};
+            for(const auto& shard : _shards) {
+                std::lock_guard lock {shard->mutex};
+                stats = stats + shard->cache.get_stats();
+            }
+            return stats;
+        }
+    };
+}// namespace kstd
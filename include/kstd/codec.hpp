@@ -0,0 +1,530 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <fmt/format.h>
+#include <string>
+
+#include "defaults.hpp"
+#include "result.hpp"
+#include "slice.hpp"
+#include "types.hpp"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif// __AVX2__
+
+namespace kstd {
+    enum class DecodeErrorKind : u8 {
+        INVALID_CHARACTER,
+        INVALID_LENGTH,
+        INVALID_PADDING,
+        BUFFER_TOO_SMALL
+    };
+
+    /**
+     * Describes why and where decoding a buffer failed.
+     * The offset is the index of the offending character for INVALID_CHARACTER
+     * (which includes characters carrying bits that do not fit into the decoded
+     * data) and INVALID_PADDING, the input size for INVALID_LENGTH
+     * and the required output size for BUFFER_TOO_SMALL.
+     */
+    struct DecodeError final {
+        using Self = DecodeError;
+
+        private:
+        DecodeErrorKind _kind;
+        usize _offset;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(DecodeError, Self, constexpr)
+
+        constexpr DecodeError(DecodeErrorKind kind, usize offset) noexcept :
+                _kind {kind},
+                _offset {offset} {
+        }
+
+        ~DecodeError() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_kind() const noexcept -> DecodeErrorKind {
+            return _kind;
+        }
+
+        [[nodiscard]] constexpr auto get_offset() const noexcept -> usize {
+            return _offset;
+        }
+
+        [[nodiscard]] inline auto to_string() const -> std::string {
+            if(_kind == DecodeErrorKind::INVALID_CHARACTER) {
+                return fmt::format("Invalid character at offset {}", _offset);
+            }
+            if(_kind == DecodeErrorKind::INVALID_LENGTH) {
+                return fmt::format("Invalid input length {}", _offset);
+            }
+            if(_kind == DecodeErrorKind::INVALID_PADDING) {
+                return fmt::format("Invalid padding at offset {}", _offset);
+            }
+            return fmt::format("Buffer is too small, {} bytes are required", _offset);
+        }
+    };
+}// namespace kstd
+
+/**
+ * Table driven scalar codecs with AVX2 kernels for the bulk of the input.
+ * The vector kernels only ever handle input that is known to be valid,
+ * as soon as a block contains anything unexpected, the remainder is
+ * passed to the scalar code which also determines the exact error offset.
+ */
+namespace kstd::codec {
+    constexpr u8 invalid_value = 0xFF;
+    constexpr char base64_padding = '=';
+
+    [[nodiscard]] constexpr auto get_base64_symbols(bool url) noexcept -> std::array<char, 64> {
+        std::array<char, 64> symbols {};
+        for(usize index = 0; index < 26; ++index) {
+            symbols[index] = static_cast<char>('A' + index);
+            symbols[index + 26] = static_cast<char>('a' + index);
+        }
+        for(usize index = 0; index < 10; ++index) {
+            symbols[index + 52] = static_cast<char>('0' + index);
+        }
+        symbols[62] = url ? '-' : '+';
+        symbols[63] = url ? '_' : '/';
+        return symbols;
+    }
+
+    template<usize SIZE>
+    [[nodiscard]] constexpr auto make_decode_table(const std::array<char, SIZE>& symbols) noexcept
+            -> std::array<u8, 256> {
+        std::array<u8, 256> table {};
+        for(auto& value : table) {
+            value = invalid_value;
+        }
+        for(usize index = 0; index < SIZE; ++index) {
+            table[static_cast<u8>(symbols[index])] = static_cast<u8>(index);
+        }
+        return table;
+    }
+
+    constexpr std::array<char, 64> base64_symbols = get_base64_symbols(false);
+    constexpr std::array<char, 64> base64_url_symbols = get_base64_symbols(true);
+    constexpr std::array<u8, 256> base64_table = make_decode_table(base64_symbols);
+    constexpr std::array<u8, 256> base64_url_table = make_decode_table(base64_url_symbols);
+
+    constexpr std::array<char, 16> hex_lower_symbols {'0', '1', '2', '3', '4', '5', '6', '7',
+                                                      '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+    constexpr std::array<char, 16> hex_upper_symbols {'0', '1', '2', '3', '4', '5', '6', '7',
+                                                      '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+
+    [[nodiscard]] constexpr auto make_hex_table() noexcept -> std::array<u8, 256> {
+        auto table = make_decode_table(hex_lower_symbols);
+        for(usize index = 10; index < 16; ++index) {
+            table[static_cast<u8>(hex_upper_symbols[index])] = static_cast<u8>(index);
+        }
+        return table;
+    }
+
+    constexpr std::array<u8, 256> hex_table = make_hex_table();
+
+#ifdef __AVX2__
+    [[nodiscard]] inline auto in_range(__m256i vector, char first, char last) noexcept -> __m256i {
+        return _mm256_andnot_si256(_mm256_cmpgt_epi8(vector, _mm256_set1_epi8(last)),
+                                   _mm256_cmpgt_epi8(vector, _mm256_set1_epi8(static_cast<char>(first - 1))));
+    }
+
+    /**
+     * Encodes 24 bytes, read from two overlapping 16 byte loads, into 32 characters.
+     * Based on the multiply-shift unpacking and the subtract-compare lookup by Wojciech Muła.
+     */
+    [[nodiscard]] inline auto encode_base64_block(const u8* data, const std::array<char, 64>& symbols) noexcept
+            -> __m256i {
+        const auto input = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))),// NOLINT
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 12)), 1);                // NOLINT
+        // Every 32-bit lane receives three input bytes as [b, a, c, b]
+        const auto shuffled = _mm256_shuffle_epi8(input, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9,
+                                                                           11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7,
+                                                                           10, 9, 11, 10));
+        const auto high = _mm256_mulhi_epu16(_mm256_and_si256(shuffled, _mm256_set1_epi32(0x0FC0FC00)),
+                                             _mm256_set1_epi32(0x04000040));
+        const auto low = _mm256_mullo_epi16(_mm256_and_si256(shuffled, _mm256_set1_epi32(0x003F03F0)),
+                                            _mm256_set1_epi32(0x01000010));
+        const auto indices = _mm256_or_si256(high, low);
+
+        // 0..25 select offset 0, 26..51 offset 1, 52..61 offsets 2..11, 62 and 63 offsets 12 and 13
+        auto offsets = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        offsets = _mm256_sub_epi8(offsets, _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(25)));
+        const auto symbol_62 = static_cast<char>(symbols[62] - 62);
+        const auto symbol_63 = static_cast<char>(symbols[63] - 63);
+        const auto lookup = _mm256_setr_epi8('A', 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, symbol_62, symbol_63, 0,
+                                             0, 'A', 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, symbol_62, symbol_63, 0,
+                                             0);
+        return _mm256_add_epi8(indices, _mm256_shuffle_epi8(lookup, offsets));
+    }
+
+    /**
+     * Decodes 32 characters into 24 bytes stored at the start of the returned vector.
+     *
+     * @return False if the block contains anything but symbols of the given alphabet.
+     */
+    [[nodiscard]] inline auto decode_base64_block(const char* data, const std::array<char, 64>& symbols,
+                                                  __m256i& out) noexcept -> bool {
+        const auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));// NOLINT
+        const auto upper = in_range(input, 'A', 'Z');
+        const auto lower = in_range(input, 'a', 'z');
+        const auto digit = in_range(input, '0', '9');
+        const auto is_62 = _mm256_cmpeq_epi8(input, _mm256_set1_epi8(symbols[62]));
+        const auto is_63 = _mm256_cmpeq_epi8(input, _mm256_set1_epi8(symbols[63]));
+        const auto valid =
+                _mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, _mm256_or_si256(is_62, is_63)));
+        if(_mm256_movemask_epi8(valid) != -1) {
+            return false;
+        }
+        auto offsets = _mm256_and_si256(upper, _mm256_set1_epi8(-'A'));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a')));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+        const auto offset_62 = _mm256_set1_epi8(static_cast<char>(62 - symbols[62]));
+        const auto offset_63 = _mm256_set1_epi8(static_cast<char>(63 - symbols[63]));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(is_62, offset_62));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(is_63, offset_63));
+        const auto values = _mm256_add_epi8(input, offsets);
+
+        // Merge [a, b, c, d] into one 24-bit value per 32-bit lane, then drop the top byte of each
+        const auto pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        const auto merged = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        const auto packed = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1,
+                                                                         -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13,
+                                                                         12, -1, -1, -1, -1));
+        out = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        return true;
+    }
+
+    /**
+     * Encodes 32 bytes into 64 characters.
+     */
+    inline auto encode_hex_block(const u8* data, const std::array<char, 16>& symbols, char* out) noexcept -> void {
+        const auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));// NOLINT
+        const auto mask = _mm256_set1_epi8(0x0F);
+        const auto lookup = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(symbols.data())));// NOLINT
+        const auto high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(input, 4), mask));
+        const auto low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(input, mask));
+        // Interleaving works per 128-bit lane, so the halves have to be put back in order
+        const auto first = _mm256_unpacklo_epi8(high, low);
+        const auto second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_permute2x128_si256(first, second, 0x20));// NOLINT
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 32),                                         // NOLINT
+                            _mm256_permute2x128_si256(first, second, 0x31));
+    }
+
+    [[nodiscard]] inline auto decode_hex_values(__m256i input, __m256i& out) noexcept -> bool {
+        const auto digit = in_range(input, '0', '9');
+        const auto lower = in_range(input, 'a', 'f');
+        const auto upper = in_range(input, 'A', 'F');
+        if(_mm256_movemask_epi8(_mm256_or_si256(digit, _mm256_or_si256(lower, upper))) != -1) {
+            return false;
+        }
+        auto offsets = _mm256_and_si256(digit, _mm256_set1_epi8(-'0'));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(lower, _mm256_set1_epi8(10 - 'a')));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(upper, _mm256_set1_epi8(10 - 'A')));
+        // Combine every pair of nibbles into a 16-bit value of high * 16 + low
+        out = _mm256_maddubs_epi16(_mm256_add_epi8(input, offsets), _mm256_set1_epi16(0x0110));
+        return true;
+    }
+
+    /**
+     * Decodes 64 characters into 32 bytes.
+     *
+     * @return False if the block contains anything but hexadecimal digits.
+     */
+    [[nodiscard]] inline auto decode_hex_block(const char* data, u8* out) noexcept -> bool {
+        __m256i first {};
+        __m256i second {};
+        if(!decode_hex_values(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), first) ||// NOLINT
+           !decode_hex_values(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32)), second)) {// NOLINT
+            return false;
+        }
+        // Packing works per 128-bit lane, so the quarters have to be put back in order
+        const auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), packed);// NOLINT
+        return true;
+    }
+#endif// __AVX2__
+}// namespace kstd::codec
+
+namespace kstd::base64 {
+    enum class Alphabet : u8 {
+        STANDARD,
+        URL
+    };
+
+    [[nodiscard]] constexpr auto get_symbols(Alphabet alphabet) noexcept -> const std::array<char, 64>& {
+        return alphabet == Alphabet::URL ? codec::base64_url_symbols : codec::base64_symbols;
+    }
+
+    /**
+     * The standard alphabet is always padded to a multiple of four characters,
+     * the URL alphabet is never padded (as is common for tokens and URLs).
+     *
+     * @return The exact number of characters base64::encode writes for the given number of bytes.
+     */
+    [[nodiscard]] constexpr auto get_encoded_size(usize size, Alphabet alphabet = Alphabet::STANDARD) noexcept
+            -> usize {
+        if(alphabet == Alphabet::STANDARD) {
+            return (size + 2) / 3 * 4;
+        }
+        const auto remainder = size % 3;
+        return size / 3 * 4 + (remainder == 0 ? 0 : remainder + 1);
+    }
+
+    /**
+     * Validates the length and padding of the given input without looking at the other characters.
+     * Both alphabets accept padded and unpadded input.
+     *
+     * @return The exact number of bytes base64::decode writes for the given input.
+     */
+    [[nodiscard]] constexpr auto get_decoded_size(Slice<const char> input) noexcept -> Result<usize, DecodeError> {
+        const auto size = input.get_count();
+        const auto* data = input.get_data();
+        usize padding = 0;
+        while(padding < size && padding < 2 && data[size - padding - 1] == codec::base64_padding) {
+            ++padding;
+        }
+        if(padding != 0 && size % 4 != 0) {
+            return Error {DecodeError {DecodeErrorKind::INVALID_PADDING, size - padding}};
+        }
+        const auto length = size - padding;
+        if(length % 4 == 1) {
+            return Error {DecodeError {DecodeErrorKind::INVALID_LENGTH, size}};
+        }
+        return length / 4 * 3 + (length % 4 == 0 ? 0 : length % 4 - 1);
+    }
+
+    /**
+     * Encodes the given bytes into the given output buffer.
+     *
+     * @return The number of characters written, see base64::get_encoded_size.
+     */
+    [[nodiscard]] inline auto encode(Slice<const u8> input, Slice<char> output,
+                                     Alphabet alphabet = Alphabet::STANDARD) noexcept -> Result<usize> {
+        const auto size = get_encoded_size(input.get_size(), alphabet);
+        if(output.get_count() < size) {
+            return Error {fmt::format("Buffer of {} characters is too small, {} characters are required",
+                                      output.get_count(), size)};
+        }
+        const auto& symbols = get_symbols(alphabet);
+        const auto* data = input.get_data();
+        const auto* end = data + input.get_size();
+        auto* out = output.get_data();
+#ifdef __AVX2__
+        // Every block reads 28 bytes but only consumes 24
+        while(end - data >= 28) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), codec::encode_base64_block(data, symbols));// NOLINT
+            data += 24;
+            out += 32;
+        }
+#endif// __AVX2__
+        for(; end - data >= 3; data += 3, out += 4) {
+            const auto value = (u32(data[0]) << 16) | (u32(data[1]) << 8) | data[2];
+            out[0] = symbols[value >> 18];
+            out[1] = symbols[(value >> 12) & 0x3F];
+            out[2] = symbols[(value >> 6) & 0x3F];
+            out[3] = symbols[value & 0x3F];
+        }
+        if(data != end) {
+            const auto value = (u32(data[0]) << 16) | (end - data == 2 ? u32(data[1]) << 8 : 0);
+            *out++ = symbols[value >> 18];
+            *out++ = symbols[(value >> 12) & 0x3F];
+            if(end - data == 2) {
+                *out++ = symbols[(value >> 6) & 0x3F];
+            }
+            else if(alphabet == Alphabet::STANDARD) {
+                *out++ = codec::base64_padding;
+            }
+            if(alphabet == Alphabet::STANDARD) {
+                *out++ = codec::base64_padding;
+            }
+        }
+        return size;
+    }
+
+    /**
+     * Decodes the given characters into the given output buffer.
+     * Characters outside of the given alphabet (including whitespace) are rejected,
+     * and so are final characters which carry bits that do not fit into the output.
+     *
+     * @return The number of bytes written, see base64::get_decoded_size.
+     */
+    [[nodiscard]] inline auto decode(Slice<const char> input, Slice<u8> output,
+                                     Alphabet alphabet = Alphabet::STANDARD) noexcept -> Result<usize, DecodeError> {
+        const auto decoded_size = get_decoded_size(input);
+        if(!decoded_size) {
+            return decoded_size;
+        }
+        const auto size = *decoded_size;
+        if(output.get_size() < size) {
+            return Error {DecodeError {DecodeErrorKind::BUFFER_TOO_SMALL, size}};
+        }
+        const auto& table = alphabet == Alphabet::URL ? codec::base64_url_table : codec::base64_table;
+        const auto* begin = input.get_data();
+        const auto* data = begin;
+        const auto* end = data + (size / 3 * 4 + (size % 3 == 0 ? 0 : size % 3 + 1));
+        auto* out = output.get_data();
+#ifdef __AVX2__
+        // Every block writes 32 bytes but only produces 24, the rest is overwritten by the following ones
+        const auto& symbols = get_symbols(alphabet);
+        const auto* out_end = out + size;
+        while(end - data >= 32 && out_end - out >= 32) {
+            __m256i block {};
+            if(!codec::decode_base64_block(data, symbols, block)) {
+                break;
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), block);// NOLINT
+            data += 32;
+            out += 24;
+        }
+#endif// __AVX2__
+        const auto get_value = [&](const char* current) noexcept -> u32 {
+            return table[static_cast<u8>(*current)];
+        };
+        // Valid digits never have the top bits set, so one check covers a whole quad
+        for(; end - data >= 4; data += 4, out += 3) {
+            const auto first = get_value(data);
+            const auto second = get_value(data + 1);
+            const auto third = get_value(data + 2);
+            const auto fourth = get_value(data + 3);
+            if(((first | second | third | fourth) & 0xC0) != 0) {
+                break;
+            }
+            const auto value = (first << 18) | (second << 12) | (third << 6) | fourth;
+            out[0] = static_cast<u8>(value >> 16);
+            out[1] = static_cast<u8>(value >> 8);
+            out[2] = static_cast<u8>(value);
+        }
+        // Decodes the final partial quad, or locates the first invalid character
+        for(; data < end; data += 4) {
+            const auto count = std::min<usize>(static_cast<usize>(end - data), 4);
+            u32 value = 0;
+            for(usize index = 0; index < count; ++index) {
+                const auto digit = get_value(data + index);
+                if(digit == codec::invalid_value) {
+                    const auto offset = static_cast<usize>(data + index - begin);
+                    const auto kind = data[index] == codec::base64_padding ? DecodeErrorKind::INVALID_PADDING
+                                                                           : DecodeErrorKind::INVALID_CHARACTER;
+                    return Error {DecodeError {kind, offset}};
+                }
+                value |= digit << (18 - 6 * index);
+            }
+            if(count < 4 && (value & ((1U << (8 * (4 - count))) - 1)) != 0) {
+                return Error {DecodeError {DecodeErrorKind::INVALID_CHARACTER, static_cast<usize>(end - 1 - begin)}};
+            }
+            for(usize index = 0; index < count - 1; ++index) {
+                *out++ = static_cast<u8>(value >> (16 - 8 * index));
+            }
+        }
+        return size;
+    }
+}// namespace kstd::base64
+
+namespace kstd::hex {
+    enum class Case : u8 {
+        LOWER,
+        UPPER
+    };
+
+    [[nodiscard]] constexpr auto get_encoded_size(usize size) noexcept -> usize {
+        return size * 2;
+    }
+
+    [[nodiscard]] constexpr auto get_decoded_size(Slice<const char> input) noexcept -> Result<usize, DecodeError> {
+        if(input.get_count() % 2 != 0) {
+            return Error {DecodeError {DecodeErrorKind::INVALID_LENGTH, input.get_count()}};
+        }
+        return input.get_count() / 2;
+    }
+
+    /**
+     * @return The number of characters written, which is always twice the number of input bytes.
+     */
+    [[nodiscard]] inline auto encode(Slice<const u8> input, Slice<char> output, Case letter_case = Case::LOWER) noexcept
+            -> Result<usize> {
+        const auto size = get_encoded_size(input.get_size());
+        if(output.get_count() < size) {
+            return Error {fmt::format("Buffer of {} characters is too small, {} characters are required",
+                                      output.get_count(), size)};
+        }
+        const auto& symbols = letter_case == Case::UPPER ? codec::hex_upper_symbols : codec::hex_lower_symbols;
+        const auto* data = input.get_data();
+        const auto* end = data + input.get_size();
+        auto* out = output.get_data();
+#ifdef __AVX2__
+        for(; end - data >= 32; data += 32, out += 64) {
+            codec::encode_hex_block(data, symbols, out);
+        }
+#endif// __AVX2__
+        for(; data != end; ++data) {
+            *out++ = symbols[*data >> 4];
+            *out++ = symbols[*data & 0x0F];
+        }
+        return size;
+    }
+
+    /**
+     * Decodes the given characters, both upper and lower case digits are accepted.
+     *
+     * @return The number of bytes written, which is always half the number of input characters.
+     */
+    [[nodiscard]] inline auto decode(Slice<const char> input, Slice<u8> output) noexcept
+            -> Result<usize, DecodeError> {
+        const auto decoded_size = get_decoded_size(input);
+        if(!decoded_size) {
+            return decoded_size;
+        }
+        const auto size = *decoded_size;
+        if(output.get_size() < size) {
+            return Error {DecodeError {DecodeErrorKind::BUFFER_TOO_SMALL, size}};
+        }
+        const auto* begin = input.get_data();
+        const auto* data = begin;
+        const auto* end = data + input.get_count();
+        auto* out = output.get_data();
+#ifdef __AVX2__
+        for(; end - data >= 64; data += 64, out += 32) {
+            if(!codec::decode_hex_block(data, out)) {
+                break;
+            }
+        }
+#endif// __AVX2__
+        for(; data != end; data += 2) {
+            const auto high = codec::hex_table[static_cast<u8>(data[0])];
+            const auto low = codec::hex_table[static_cast<u8>(data[1])];
+            if(high == codec::invalid_value || low == codec::invalid_value) {
+                const auto offset = static_cast<usize>(data - begin) + (high == codec::invalid_value ? 0 : 1);
+                return Error {DecodeError {DecodeErrorKind::INVALID_CHARACTER, offset}};
+            }
+            *out++ = static_cast<u8>((high << 4) | low);
+        }
+        return size;
+    }
+}// namespace kstd::hex
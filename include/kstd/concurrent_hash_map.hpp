@@ -0,0 +1,397 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+
+#include "defaults.hpp"
+#include "hash.hpp"
+#include "option.hpp"
+#include "result.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    /**
+     * A hash map which can be shared between threads.
+     * Keys are distributed across independently locked shards using the high bits
+     * of their (mixed) hash, the low bits select the slot inside the shard's
+     * open addressing table. Lookups only take the shard's lock in shared mode,
+     * so readers of the same shard never block each other. Every shard grows on
+     * its own, which means a resize only ever blocks the threads touching that
+     * single shard while all other shards keep serving requests.
+     *
+     * @tparam K The type of the keys.
+     * @tparam V The type of the values.
+     * @tparam HASH The hash function used for the keys.
+     * @tparam EQUAL The equality function used for the keys.
+     */
+    template<typename K, typename V, typename HASH = Hash<K>, typename EQUAL = std::equal_to<K>>
+    class ConcurrentHashMap final {
+        public:
+        using KeyType = K;
+        using ValueType = V;
+        using Self = ConcurrentHashMap<KeyType, ValueType, HASH, EQUAL>;
+        using Entry = std::pair<KeyType, ValueType>;
+
+        private:
+        static constexpr usize min_capacity = 8;
+        static constexpr usize hash_bits = sizeof(usize) << 3;
+
+        struct Slot final {
+            usize hash;// Zero marks an empty slot
+            alignas(Entry) u8 storage[sizeof(Entry)];
+
+            [[nodiscard]] inline auto get() noexcept -> Entry& {
+                return *std::launder(reinterpret_cast<Entry*>(storage));
+            }
+        };
+
+        struct alignas(64) Shard final {
+            mutable std::shared_mutex mutex;
+            std::unique_ptr<Slot[]> slots;
+            usize capacity;
+            std::atomic<usize> size;
+
+            Shard() noexcept :
+                    mutex {},
+                    slots {},
+                    capacity {0},
+                    size {0} {
+            }
+
+            ~Shard() noexcept {
+                clear();
+            }
+
+            inline auto clear() noexcept -> void {
+                for(usize index = 0; index < capacity; ++index) {
+                    auto& slot = slots[index];
+                    if(slot.hash != 0) {
+                        slot.get().~Entry();
+                        slot.hash = 0;
+                    }
+                }
+                size.store(0, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] inline auto find(usize hash, const KeyType& key, const EQUAL& equal) const noexcept
+                    -> Option<usize> {
+                if(capacity == 0) {
+                    return {};
+                }
+                const auto mask = capacity - 1;
+                for(auto index = hash & mask;; index = (index + 1) & mask) {
+                    auto& slot = slots[index];
+                    if(slot.hash == 0) {
+                        return {};
+                    }
+                    if(slot.hash == hash && equal(slot.get().first, key)) {
+                        return index;
+                    }
+                }
+            }
+
+            inline auto place(usize hash, Entry&& entry) noexcept -> void {
+                const auto mask = capacity - 1;
+                auto index = hash & mask;
+                while(slots[index].hash != 0) {
+                    index = (index + 1) & mask;
+                }
+                auto& slot = slots[index];
+                new(slot.storage) Entry(std::move(entry));
+                slot.hash = hash;
+            }
+
+            inline auto rehash(usize new_capacity) -> void {
+                auto old_slots = std::exchange(slots, std::make_unique<Slot[]>(new_capacity));
+                const auto old_capacity = std::exchange(capacity, new_capacity);
+                for(usize index = 0; index < capacity; ++index) {
+                    slots[index].hash = 0;
+                }
+                for(usize index = 0; index < old_capacity; ++index) {
+                    auto& slot = old_slots[index];
+                    if(slot.hash == 0) {
+                        continue;
+                    }
+                    place(slot.hash, std::move(slot.get()));
+                    slot.get().~Entry();
+                }
+            }
+
+            inline auto reserve(usize count) -> void {
+                // Keep the load factor below 3/4, linear probing degrades quickly above that
+                auto new_capacity = capacity == 0 ? min_capacity : capacity;
+                while(count * 4 > new_capacity * 3) {
+                    new_capacity <<= 1;
+                }
+                if(new_capacity != capacity) {
+                    rehash(new_capacity);
+                }
+            }
+
+            /**
+             * Removes the entry at the given index by shifting back the following
+             * entries of the probe sequence, so the table never needs tombstones.
+             */
+            inline auto remove(usize index) noexcept -> void {
+                const auto mask = capacity - 1;
+                slots[index].get().~Entry();
+                slots[index].hash = 0;
+                for(auto next = (index + 1) & mask; slots[next].hash != 0; next = (next + 1) & mask) {
+                    auto& slot = slots[next];
+                    const auto home = slot.hash & mask;
+                    if(((next - home) & mask) < ((next - index) & mask)) {
+                        continue;
+                    }
+                    new(slots[index].storage) Entry(std::move(slot.get()));
+                    slots[index].hash = slot.hash;
+                    slot.get().~Entry();
+                    slot.hash = 0;
+                    index = next;
+                }
+                size.fetch_sub(1, std::memory_order_relaxed);
+            }
+        };
+
+        std::unique_ptr<Shard[]> _shards;
+        usize _shard_count;
+        usize _shard_shift;
+        HASH _hash;
+        EQUAL _equal;
+
+        [[nodiscard]] inline auto get_hash(const KeyType& key) const noexcept -> usize {
+            // Shards are selected by the high bits, so every key bit has to reach them
+            const auto hash = mix_hash(_hash(key));
+            return hash == 0 ? 1 : hash;
+        }
+
+        [[nodiscard]] inline auto get_shard(usize hash) const noexcept -> Shard& {
+            return _shards[_shard_shift == hash_bits ? 0 : hash >> _shard_shift];
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(ConcurrentHashMap, Self, constexpr)
+
+        /**
+         * @param shard_count The number of independently locked shards, rounded up to a power of two.
+         * @param capacity The number of entries to reserve space for.
+         */
+        explicit ConcurrentHashMap(usize shard_count = 64, usize capacity = 0, HASH hash = HASH {},
+                                   EQUAL equal = EQUAL {}) :
+                _shards {},
+                _shard_count {1},
+                _shard_shift {hash_bits},
+                _hash {std::move(hash)},
+                _equal {std::move(equal)} {
+            while(_shard_count < shard_count) {
+                _shard_count <<= 1;
+                --_shard_shift;
+            }
+            _shards = std::make_unique<Shard[]>(_shard_count);
+            if(capacity > 0) {
+                reserve(capacity);
+            }
+        }
+
+        ~ConcurrentHashMap() noexcept = default;
+
+        [[nodiscard]] inline auto get_shard_count() const noexcept -> usize {
+            return _shard_count;
+        }
+
+        /**
+         * @return The number of entries. Concurrent modifications may or may not be reflected.
+         */
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            usize size = 0;
+            for(usize index = 0; index < _shard_count; ++index) {
+                size += _shards[index].size.load(std::memory_order_relaxed);
+            }
+            return size;
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return get_size() == 0;
+        }
+
+        /**
+         * @return A copy of the value associated with the given key, if present.
+         */
+        [[nodiscard]] inline auto find(const KeyType& key) const noexcept -> Option<ValueType> {
+            const auto hash = get_hash(key);
+            auto& shard = get_shard(hash);
+            std::shared_lock lock {shard.mutex};
+            if(auto index = shard.find(hash, key, _equal)) {
+                return shard.slots[*index].get().second;
+            }
+            return {};
+        }
+
+        [[nodiscard]] inline auto contains(const KeyType& key) const noexcept -> bool {
+            const auto hash = get_hash(key);
+            auto& shard = get_shard(hash);
+            std::shared_lock lock {shard.mutex};
+            return shard.find(hash, key, _equal).has_value();
+        }
+
+        /**
+         * Inserts a new entry, failing if the key is already present.
+         */
+        [[nodiscard]] inline auto insert(KeyType key, ValueType value) -> Result<void> {
+            const auto hash = get_hash(key);
+            auto& shard = get_shard(hash);
+            std::unique_lock lock {shard.mutex};
+            if(shard.find(hash, key, _equal)) {
+                return Error {std::string {"Key is already present"}};
+            }
+            shard.reserve(shard.size.load(std::memory_order_relaxed) + 1);
+            shard.place(hash, Entry {std::move(key), std::move(value)});
+            shard.size.fetch_add(1, std::memory_order_relaxed);
+            return {};
+        }
+
+        /**
+         * Inserts a new entry or replaces the value of an existing one.
+         *
+         * @return True if a new entry was inserted, false if an existing value was replaced.
+         */
+        inline auto insert_or_assign(KeyType key, ValueType value) -> bool {
+            const auto hash = get_hash(key);
+            auto& shard = get_shard(hash);
+            std::unique_lock lock {shard.mutex};
+            if(auto index = shard.find(hash, key, _equal)) {
+                shard.slots[*index].get().second = std::move(value);
+                return false;
+            }
+            shard.reserve(shard.size.load(std::memory_order_relaxed) + 1);
+            shard.place(hash, Entry {std::move(key), std::move(value)});
+            shard.size.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * Returns the value associated with the given key, inserting the
+         * result of the given function first if the key is not present.
+         * The function is invoked while the shard is locked.
+         */
+        template<typename F>
+        inline auto get_or_insert_with(const KeyType& key, F&& function) -> ValueType {
+            static_assert(std::is_invocable_r_v<ValueType, F>, "Function must produce a value");
+            const auto hash = get_hash(key);
+            auto& shard = get_shard(hash);
+            {
+                std::shared_lock lock {shard.mutex};
+                if(auto index = shard.find(hash, key, _equal)) {
+                    return shard.slots[*index].get().second;
+                }
+            }
+            std::unique_lock lock {shard.mutex};
+            if(auto index = shard.find(hash, key, _equal)) {
+                return shard.slots[*index].get().second;// Inserted by another thread in the meantime
+            }
+            auto value = std::forward<F>(function)();
+            shard.reserve(shard.size.load(std::memory_order_relaxed) + 1);
+            shard.place(hash, Entry {key, value});
+            shard.size.fetch_add(1, std::memory_order_relaxed);
+            return value;
+        }
+
+        /**
+         * Modifies the value associated with the given key in place while the shard is locked.
+         *
+         * @return True if the key was present.
+         */
+        template<typename F>
+        inline auto update(const KeyType& key, F&& function) -> bool {
+            const auto hash = get_hash(key);
+            auto& shard = get_shard(hash);
+            std::unique_lock lock {shard.mutex};
+            auto index = shard.find(hash, key, _equal);
+            if(!index) {
+                return false;
+            }
+            std::forward<F>(function)(shard.slots[*index].get().second);
+            return true;
+        }
+
+        /**
+         * @return The removed value, if the key was present.
+         */
+        inline auto erase(const KeyType& key) -> Option<ValueType> {
+            const auto hash = get_hash(key);
+            auto& shard = get_shard(hash);
+            std::unique_lock lock {shard.mutex};
+            auto index = shard.find(hash, key, _equal);
+            if(!index) {
+                return {};
+            }
+            auto value = std::move(shard.slots[*index].get().second);
+            shard.remove(*index);
+            return value;
+        }
+
+        /**
+         * Reserves space for the given total number of entries, assuming they are evenly distributed.
+         */
+        inline auto reserve(usize capacity) -> void {
+            const auto per_shard = (capacity + _shard_count - 1) / _shard_count;
+            for(usize index = 0; index < _shard_count; ++index) {
+                auto& shard = _shards[index];
+                std::unique_lock lock {shard.mutex};
+                shard.reserve(per_shard);
+            }
+        }
+
+        inline auto clear() noexcept -> void {
+            for(usize index = 0; index < _shard_count; ++index) {
+                auto& shard = _shards[index];
+                std::unique_lock lock {shard.mutex};
+                shard.clear();
+            }
+        }
+
+        /**
+         * Invokes the given function for every entry, one shard at a time.
+         * The function receives the key and a const reference to the value and
+         * must not access the map itself, since the current shard is locked.
+         */
+        template<typename F>
+        inline auto for_each(F&& function) const -> void {
+            for(usize shard_index = 0; shard_index < _shard_count; ++shard_index) {
+                auto& shard = _shards[shard_index];
+                std::shared_lock lock {shard.mutex};
+                for(usize index = 0; index < shard.capacity; ++index) {
+                    auto& slot = shard.slots[index];
+                    if(slot.hash != 0) {
+                        const auto& entry = slot.get();
+                        function(entry.first, entry.second);
+                    }
+                }
+            }
+        }
+    };
+}// namespace kstd
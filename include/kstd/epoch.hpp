@@ -0,0 +1,224 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "assert.hpp"
+#include "defaults.hpp"
+#include "reclaim.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    /**
+     * Epoch-based memory reclamation domain for lock-free data structures.
+     * Readers pin the current epoch for the duration of a Guard, writers retire
+     * unlinked objects instead of deleting them. Retired objects are tagged with
+     * the global epoch and reclaimed in batches once the global epoch has advanced
+     * twice past their tag, at which point no pinned reader can still observe them.
+     * Pinning and unpinning never take a lock; every thread lazily registers one
+     * record per domain which is recycled when the thread exits.
+     */
+    class Epoch final {
+        struct alignas(64) Record final {
+            std::atomic<u64> local_epoch {0};// (epoch << 1) | 1 while pinned, 0 otherwise
+            std::atomic_bool in_use {true};
+            usize depth {0};
+            usize collect_at {0};
+            std::vector<std::pair<u64, Retired>> retired {};
+            Record* next {nullptr};
+        };
+
+        struct State final {
+            std::atomic<u64> global_epoch {0};
+            std::atomic<Record*> head {nullptr};
+            usize threshold;
+
+            explicit State(usize threshold) noexcept :
+                    threshold {threshold} {
+            }
+
+            ~State() noexcept {
+                for(auto* record = head.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+                    for(auto& [_, retired] : record->retired) {
+                        retired.reclaim();
+                    }
+                }
+                reclamation::destroy(head);
+            }
+
+            inline auto try_advance() noexcept -> u64 {
+                const auto epoch = global_epoch.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                for(auto* record = head.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+                    const auto local_epoch = record->local_epoch.load(std::memory_order_relaxed);
+                    if((local_epoch & 1) != 0 && (local_epoch >> 1) != epoch) {
+                        return epoch;// Someone is still pinned in an older epoch
+                    }
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                auto expected = epoch;
+                if(global_epoch.compare_exchange_strong(expected, epoch + 1, std::memory_order_release,
+                                                        std::memory_order_relaxed)) {
+                    return epoch + 1;
+                }
+                return expected;
+            }
+
+            inline auto collect(Record& record) noexcept -> usize {
+                const auto epoch = try_advance();
+                auto& retired = record.retired;
+                const auto safe = std::partition(retired.begin(), retired.end(), [epoch](const auto& entry) {
+                    return entry.first + 2 > epoch;
+                });
+                const auto count = static_cast<usize>(retired.end() - safe);
+                for(auto entry = safe; entry != retired.end(); ++entry) {
+                    entry->second.reclaim();
+                }
+                retired.erase(safe, retired.end());
+                return count;
+            }
+        };
+
+        std::shared_ptr<State> _state;
+
+        [[nodiscard]] inline auto get_record() const noexcept -> Record& {
+            return reclamation::get_record(_state, _state->head);
+        }
+
+        public:
+        /**
+         * RAII object which keeps the current thread pinned for its lifetime.
+         * Pointers loaded from a structure protected by the domain stay valid
+         * until the guard is destroyed. Guards may be nested.
+         */
+        class Guard final {
+            Record* _record;
+
+            friend class Epoch;
+
+            explicit Guard(Record& record) noexcept :
+                    _record {&record} {
+            }
+
+            public:
+            KSTD_NO_COPY(Guard, Guard, constexpr)
+
+            Guard(Guard&& other) noexcept :
+                    _record {std::exchange(other._record, nullptr)} {
+            }
+
+            ~Guard() noexcept {
+                release();
+            }
+
+            auto operator=(Guard&& other) noexcept -> Guard& {
+                if(this != &other) {
+                    release();
+                    _record = std::exchange(other._record, nullptr);
+                }
+                return *this;
+            }
+
+            inline auto release() noexcept -> void {
+                if(_record == nullptr) {
+                    return;
+                }
+                if(--_record->depth == 0) {
+                    _record->local_epoch.store(0, std::memory_order_release);
+                }
+                _record = nullptr;
+            }
+        };
+
+        KSTD_DEFAULT_MOVE_COPY(Epoch, Epoch, inline)
+
+        /**
+         * @param threshold The number of retired objects per thread after which a collection is attempted.
+         */
+        explicit Epoch(usize threshold = 128) noexcept :
+                _state {std::make_shared<State>(threshold)} {
+        }
+
+        ~Epoch() noexcept = default;
+
+        /**
+         * @return The process-wide default reclamation domain.
+         */
+        [[nodiscard]] static inline auto get_global() noexcept -> Epoch& {
+            static Epoch epoch {};
+            return epoch;
+        }
+
+        [[nodiscard]] inline auto pin() const noexcept -> Guard {
+            auto& record = get_record();
+            if(record.depth++ == 0) {
+                const auto epoch = _state->global_epoch.load(std::memory_order_relaxed);
+                record.local_epoch.store((epoch << 1) | 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+            return Guard {record};
+        }
+
+        /**
+         * Defers the destruction of the given object until no pinned thread can observe it anymore.
+         * The object must already be unreachable for threads which pin the domain afterwards.
+         *
+         * @tparam T The type of the object to retire.
+         * @tparam D The type of the deleter used for reclaiming the object.
+         * @param pointer A pointer to the object to retire.
+         * @param deleter The deleter which is invoked on the object once it is safe to do so.
+         */
+        template<typename T, typename D = std::default_delete<T>>
+        inline auto retire(T* pointer, D deleter = D {}) const noexcept -> void {
+            auto& record = get_record();
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const auto epoch = _state->global_epoch.load(std::memory_order_relaxed);
+            record.retired.emplace_back(epoch, Retired::make(pointer, std::move(deleter)));
+            if(record.retired.size() >= record.collect_at) {
+                _state->collect(record);
+                // Back off if a slow reader prevents reclamation, so retiring stays amortized O(1)
+                record.collect_at = record.retired.size() + _state->threshold;
+            }
+        }
+
+        /**
+         * Tries to advance the global epoch and reclaims all objects retired
+         * by the calling thread which are safe to reclaim.
+         *
+         * @return The number of reclaimed objects.
+         */
+        inline auto collect() const noexcept -> usize {
+            return _state->collect(get_record());
+        }
+
+        [[nodiscard]] inline auto get_epoch() const noexcept -> u64 {
+            return _state->global_epoch.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] inline auto get_pending_count() const noexcept -> usize {
+            return get_record().retired.size();
+        }
+    };
+}// namespace kstd
@@ -0,0 +1,370 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "assert.hpp"
+#include "defaults.hpp"
+#include "option.hpp"
+#include "result.hpp"
+#include "slice.hpp"
+#include "static_vector.hpp"
+#include "types.hpp"
+
+namespace kstd::flat_map {
+    /**
+     * Keeps keys and values in two separately allocated arrays.
+     */
+    template<typename K, typename V>
+    struct HeapStorage final {
+        static constexpr bool is_fixed_capacity = false;
+
+        std::vector<K> keys;
+        std::vector<V> values;
+
+        [[nodiscard]] inline auto get_key_data() const noexcept -> const K* {
+            return keys.data();
+        }
+
+        [[nodiscard]] inline auto get_value_data() noexcept -> V* {
+            return values.data();
+        }
+
+        [[nodiscard]] inline auto get_value_data() const noexcept -> const V* {
+            return values.data();
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return keys.size();
+        }
+
+        [[nodiscard]] inline auto get_capacity() const noexcept -> usize {
+            return keys.capacity();
+        }
+
+        inline auto reserve(usize capacity) -> void {
+            keys.reserve(capacity);
+            values.reserve(capacity);
+        }
+
+        inline auto insert(usize index, K key, V value) -> void {
+            keys.insert(keys.begin() + static_cast<isize>(index), std::move(key));
+            values.insert(values.begin() + static_cast<isize>(index), std::move(value));
+        }
+
+        inline auto erase(usize index) -> V {
+            auto value = std::move(values[index]);
+            keys.erase(keys.begin() + static_cast<isize>(index));
+            values.erase(values.begin() + static_cast<isize>(index));
+            return value;
+        }
+
+        inline auto clear() noexcept -> void {
+            keys.clear();
+            values.clear();
+        }
+    };
+
+    /**
+     * Keeps keys and values inline in two fixed-capacity arrays, without any heap allocation.
+     */
+    template<typename K, typename V, usize SIZE>
+    struct InlineStorage final {
+        static constexpr bool is_fixed_capacity = true;
+
+        StaticVector<K, SIZE> keys;
+        StaticVector<V, SIZE> values;
+
+        [[nodiscard]] constexpr auto get_key_data() const noexcept -> const K* {
+            return keys.get_data();
+        }
+
+        [[nodiscard]] constexpr auto get_value_data() noexcept -> V* {
+            return values.get_data();
+        }
+
+        [[nodiscard]] constexpr auto get_value_data() const noexcept -> const V* {
+            return values.get_data();
+        }
+
+        [[nodiscard]] constexpr auto get_size() const noexcept -> usize {
+            return keys.get_size();
+        }
+
+        [[nodiscard]] constexpr auto get_capacity() const noexcept -> usize {
+            return SIZE;
+        }
+
+        constexpr auto reserve(usize capacity) noexcept -> void {
+            assert_true(capacity <= SIZE);
+        }
+
+        constexpr auto insert(usize index, K key, V value) noexcept -> void {
+            keys.insert(index, std::move(key));
+            values.insert(index, std::move(value));
+        }
+
+        constexpr auto erase(usize index) noexcept -> V {
+            static_cast<void>(keys.erase(index));
+            return values.erase(index);
+        }
+
+        constexpr auto clear() noexcept -> void {
+            keys.clear();
+            values.clear();
+        }
+    };
+}// namespace kstd::flat_map
+
+namespace kstd {
+    /**
+     * An ordered map which keeps its keys and values in two separate sorted arrays.
+     * Lookups are a branchless binary search over the densely packed keys,
+     * and values are only touched once their key was found.
+     * Insertions and removals shift all following entries, so this is meant for
+     * maps which are mostly read, or built in bulk from a list of entries.
+     *
+     * @tparam K The type of the keys.
+     * @tparam V The type of the values.
+     * @tparam STORAGE The type of the storage holding keys and values.
+     * @tparam LESS The strict weak ordering of the keys.
+     */
+    template<typename K, typename V, typename STORAGE, typename LESS = std::less<K>>
+    class BasicFlatMap final {
+        public:
+        using KeyType = K;
+        using ValueType = V;
+        using EntryType = std::pair<K, V>;
+        using Self = BasicFlatMap<K, V, STORAGE, LESS>;
+
+        private:
+        STORAGE _storage;
+        LESS _less;
+
+        /**
+         * Sorts the given entries and appends them, keeping the first entry of every key.
+         * Fixed capacity storage inserts the entries one by one instead, since the number
+         * of entries before removing duplicate keys may exceed its capacity.
+         */
+        inline auto assign(const EntryType* entries, usize count) -> void {
+            _storage.clear();
+            if constexpr(STORAGE::is_fixed_capacity) {
+                for(usize index = 0; index < count; ++index) {
+                    const auto& entry = entries[index];
+                    const auto inserted = insert(entry.first, entry.second);
+                    assert_true(inserted || contains(entry.first));// More distinct keys than the capacity
+                }
+                return;
+            }
+            _storage.reserve(count);
+            std::vector<usize> order(count);
+            for(usize index = 0; index < count; ++index) {
+                order[index] = index;
+            }
+            std::sort(order.begin(), order.end(), [this, entries](usize lhs, usize rhs) {
+                const auto& lhs_key = entries[lhs].first;
+                const auto& rhs_key = entries[rhs].first;
+                return _less(lhs_key, rhs_key) || (!_less(rhs_key, lhs_key) && lhs < rhs);
+            });
+            for(const auto index : order) {
+                const auto& entry = entries[index];
+                const auto size = _storage.get_size();
+                if(size > 0 && !_less(_storage.keys[size - 1], entry.first)) {
+                    continue;
+                }
+                _storage.insert(size, entry.first, entry.second);
+            }
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(BasicFlatMap, Self, inline)
+
+        BasicFlatMap() noexcept :
+                _storage {},
+                _less {} {
+        }
+
+        /**
+         * Creates a new map from the given entries in any order.
+         * If a key appears more than once, its first entry wins.
+         */
+        explicit BasicFlatMap(Slice<const EntryType> entries) :
+                _storage {},
+                _less {} {
+            assign(entries.get_data(), entries.get_count());
+        }
+
+        BasicFlatMap(std::initializer_list<EntryType> entries) :
+                _storage {},
+                _less {} {
+            assign(entries.begin(), entries.size());
+        }
+
+        ~BasicFlatMap() noexcept = default;
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _storage.get_size();
+        }
+
+        [[nodiscard]] inline auto get_capacity() const noexcept -> usize {
+            return _storage.get_capacity();
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return _storage.get_size() == 0;
+        }
+
+        inline auto reserve(usize capacity) -> void {
+            _storage.reserve(capacity);
+        }
+
+        inline auto clear() noexcept -> void {
+            _storage.clear();
+        }
+
+        /**
+         * @return The index of the first key which is not less than the given key,
+         *         or the size of this map if there is none.
+         */
+        [[nodiscard]] inline auto lower_bound(const K& key) const noexcept -> usize {
+            const auto* keys = _storage.get_key_data();
+            const auto* base = keys;
+            auto count = _storage.get_size();
+            if(count == 0) {
+                return 0;
+            }
+            while(count > 1) {
+                const auto half = count / 2;
+                // Compiles to a conditional move instead of a branch
+                base = _less(base[half - 1], key) ? base + half : base;
+                count -= half;
+            }
+            return static_cast<usize>(base - keys) + static_cast<usize>(_less(*base, key));
+        }
+
+        [[nodiscard]] inline auto find(const K& key) noexcept -> Option<V&> {
+            const auto index = lower_bound(key);
+            if(index == get_size() || _less(key, _storage.keys[index])) {
+                return {};
+            }
+            return _storage.values[index];
+        }
+
+        [[nodiscard]] inline auto find(const K& key) const noexcept -> Option<const V&> {
+            const auto index = lower_bound(key);
+            if(index == get_size() || _less(key, _storage.keys[index])) {
+                return {};
+            }
+            return _storage.values[index];
+        }
+
+        [[nodiscard]] inline auto contains(const K& key) const noexcept -> bool {
+            const auto index = lower_bound(key);
+            return index < get_size() && !_less(key, _storage.keys[index]);
+        }
+
+        /**
+         * Inserts the given entry if the key is not present yet.
+         *
+         * @return True if the entry was inserted, false if the key was present or the map is full.
+         */
+        inline auto insert(K key, V value) -> bool {
+            const auto index = lower_bound(key);
+            if(index < get_size() && !_less(key, _storage.keys[index])) {
+                return false;
+            }
+            if(STORAGE::is_fixed_capacity && get_size() == get_capacity()) {
+                return false;
+            }
+            _storage.insert(index, std::move(key), std::move(value));
+            return true;
+        }
+
+        /**
+         * Inserts the given entry or replaces the value of an existing one.
+         *
+         * @return True if the entry was inserted, false if it was replaced,
+         *         or an error if the key is not present and the map is full.
+         */
+        inline auto insert_or_assign(K key, V value) -> Result<bool> {
+            const auto index = lower_bound(key);
+            if(index < get_size() && !_less(key, _storage.keys[index])) {
+                _storage.values[index] = std::move(value);
+                return false;
+            }
+            if(STORAGE::is_fixed_capacity && get_size() == get_capacity()) {
+                return Error {fmt::format("Map is full, it can hold at most {} entries", get_capacity())};
+            }
+            _storage.insert(index, std::move(key), std::move(value));
+            return true;
+        }
+
+        /**
+         * @return The value of the removed entry, if there was one for the given key.
+         */
+        inline auto erase(const K& key) -> Option<V> {
+            const auto index = lower_bound(key);
+            if(index == get_size() || _less(key, _storage.keys[index])) {
+                return {};
+            }
+            return _storage.erase(index);
+        }
+
+        [[nodiscard]] inline auto get_keys() const noexcept -> Slice<const K> {
+            return {_storage.get_key_data(), get_size() * sizeof(K)};
+        }
+
+        [[nodiscard]] inline auto get_values() noexcept -> Slice<V> {
+            return {_storage.get_value_data(), get_size() * sizeof(V)};
+        }
+
+        [[nodiscard]] inline auto get_values() const noexcept -> Slice<const V> {
+            return {_storage.get_value_data(), get_size() * sizeof(V)};
+        }
+
+        /**
+         * Invokes the given function with every key and value in ascending key order.
+         */
+        template<typename F>
+        inline auto for_each(F&& function) -> void {
+            for(usize index = 0; index < get_size(); ++index) {
+                function(std::as_const(_storage.keys[index]), _storage.values[index]);
+            }
+        }
+
+        template<typename F>
+        inline auto for_each(F&& function) const -> void {
+            for(usize index = 0; index < get_size(); ++index) {
+                function(_storage.keys[index], _storage.values[index]);
+            }
+        }
+    };
+
+    template<typename K, typename V, typename LESS = std::less<K>>
+    using FlatMap = BasicFlatMap<K, V, flat_map::HeapStorage<K, V>, LESS>;
+
+    template<typename K, typename V, usize SIZE, typename LESS = std::less<K>>
+    using StaticFlatMap = BasicFlatMap<K, V, flat_map::InlineStorage<K, V, SIZE>, LESS>;
+}// namespace kstd
@@ -0,0 +1,204 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "assert.hpp"
+#include "defaults.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    template<typename SIGNATURE, usize INLINE_SIZE = sizeof(void*) * 3>
+    class Function;
+
+    /**
+     * A move-only, type-erased callable, similar to std::move_only_function.
+     * Callables which fit into the inline storage (and can be moved without
+     * throwing) are stored in place, larger ones are allocated on the heap.
+     * Dispatch goes through a static table of function pointers per callable
+     * type, so no RTTI is required. Trivially copyable callables, as well as
+     * heap allocated ones, are moved with a plain memcpy of the storage.
+     *
+     * @tparam R The return type of the callable.
+     * @tparam ARGS The parameter types of the callable.
+     * @tparam INLINE_SIZE The number of bytes available for storing callables in place.
+     */
+    template<typename R, typename... ARGS, usize INLINE_SIZE>
+    class Function<R(ARGS...), INLINE_SIZE> final {
+        public:
+        using ReturnType = R;
+        using Self = Function<ReturnType(ARGS...), INLINE_SIZE>;
+
+        static constexpr usize inline_size = INLINE_SIZE < sizeof(void*) ? sizeof(void*) : INLINE_SIZE;
+
+        private:
+        struct VTable final {
+            ReturnType (*invoke)(void* storage, ARGS&&... args);
+            // Null if the storage can be relocated with memcpy
+            void (*relocate)(void* destination, void* source) noexcept;
+            // Null if nothing needs to be destroyed
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template<typename F>
+        struct InlineOps final {
+            static auto invoke(void* storage, ARGS&&... args) -> ReturnType {
+                return static_cast<ReturnType>((*std::launder(reinterpret_cast<F*>(storage)))(std::forward<ARGS>(args)...));
+            }
+
+            static auto relocate(void* destination, void* source) noexcept -> void {
+                auto* value = std::launder(reinterpret_cast<F*>(source));
+                new(destination) F(std::move(*value));
+                value->~F();
+            }
+
+            static auto destroy(void* storage) noexcept -> void {
+                std::launder(reinterpret_cast<F*>(storage))->~F();
+            }
+
+            static constexpr bool is_trivial = std::is_trivially_copyable_v<F> && std::is_trivially_destructible_v<F>;
+            static constexpr VTable vtable {invoke, is_trivial ? nullptr : relocate, is_trivial ? nullptr : destroy};
+        };
+
+        template<typename F>
+        struct HeapOps final {
+            [[nodiscard]] static auto get(void* storage) noexcept -> F* {
+                F* pointer = nullptr;
+                std::memcpy(&pointer, storage, sizeof(F*));
+                return pointer;
+            }
+
+            static auto invoke(void* storage, ARGS&&... args) -> ReturnType {
+                return static_cast<ReturnType>((*get(storage))(std::forward<ARGS>(args)...));
+            }
+
+            static auto destroy(void* storage) noexcept -> void {
+                delete get(storage);
+            }
+
+            static constexpr VTable vtable {invoke, nullptr, destroy};
+        };
+
+        alignas(std::max_align_t) u8 _storage[inline_size];
+        const VTable* _vtable;
+
+        inline auto move_from(Self& other) noexcept -> void {
+            if(other._vtable == nullptr) {
+                return;
+            }
+            if(other._vtable->relocate != nullptr) {
+                other._vtable->relocate(_storage, other._storage);
+            }
+            else {
+                std::memcpy(_storage, other._storage, inline_size);
+            }
+            _vtable = std::exchange(other._vtable, nullptr);
+        }
+
+        public:
+        /**
+         * @return True if a callable of the given type is stored in place instead of on the heap.
+         */
+        template<typename F>
+        [[nodiscard]] static constexpr auto stores_inline() noexcept -> bool {
+            return sizeof(F) <= inline_size && alignof(F) <= alignof(std::max_align_t) &&
+                   std::is_nothrow_move_constructible_v<F>;
+        }
+
+        KSTD_NO_COPY(Function, Self, constexpr)
+
+        Function() noexcept :
+                _storage {},
+                _vtable {nullptr} {
+        }
+
+        Function(std::nullptr_t) noexcept :// NOLINT
+                Function() {
+        }
+
+        template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Self> &&
+                                                         std::is_invocable_r_v<ReturnType, std::decay_t<F>&, ARGS...>>>
+        Function(F&& function) :// NOLINT
+                _storage {},
+                _vtable {nullptr} {
+            using Callable = std::decay_t<F>;
+            if constexpr(stores_inline<Callable>()) {
+                new(_storage) Callable(std::forward<F>(function));
+                _vtable = &InlineOps<Callable>::vtable;
+            }
+            else {
+                auto* pointer = new Callable(std::forward<F>(function));
+                std::memcpy(_storage, &pointer, sizeof(Callable*));
+                _vtable = &HeapOps<Callable>::vtable;
+            }
+        }
+
+        Function(Function&& other) noexcept :
+                _storage {},
+                _vtable {nullptr} {
+            move_from(other);
+        }
+
+        ~Function() noexcept {
+            reset();
+        }
+
+        auto operator=(Function&& other) noexcept -> Function& {
+            if(this != &other) {
+                reset();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        auto operator=(std::nullptr_t) noexcept -> Function& {
+            reset();
+            return *this;
+        }
+
+        inline auto reset() noexcept -> void {
+            if(_vtable == nullptr) {
+                return;
+            }
+            if(_vtable->destroy != nullptr) {
+                _vtable->destroy(_storage);
+            }
+            _vtable = nullptr;
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return _vtable == nullptr;
+        }
+
+        [[nodiscard]] inline operator bool() const noexcept {// NOLINT
+            return _vtable != nullptr;
+        }
+
+        inline auto operator()(ARGS... args) -> ReturnType {
+            assert_false(is_empty());
+            return _vtable->invoke(_storage, std::forward<ARGS>(args)...);
+        }
+    };
+}// namespace kstd
@@ -47,6 +47,43 @@ namespace kstd {
         return result;
     }
 
+    /**
+     * Finalizes the given hash value so that every input bit affects every output bit.
+     * This matters for hash tables which only use a subset of the bits, since
+     * std::hash is the identity function for integers on most implementations.
+     */
+    [[nodiscard]] constexpr auto mix_hash(usize value) noexcept -> usize {
+        if constexpr(sizeof(usize) == 8) {
+            value ^= value >> 33;
+            value *= static_cast<usize>(0xFF51AFD7ED558CCDULL);
+            value ^= value >> 33;
+            value *= static_cast<usize>(0xC4CEB9FE1A85EC53ULL);
+            value ^= value >> 33;
+        }
+        else {
+            value ^= value >> 16;
+            value *= static_cast<usize>(0x85EBCA6BU);
+            value ^= value >> 13;
+            value *= static_cast<usize>(0xC2B2AE35U);
+            value ^= value >> 16;
+        }
+        return value;
+    }
+
+    /**
+     * Like mix_hash, but always yields 64 bits, so callers which split the
+     * result into two halves also work on targets with a 32-bit usize.
+     */
+    [[nodiscard]] constexpr auto mix_hash64(usize value) noexcept -> u64 {
+        if constexpr(sizeof(usize) >= 8) {
+            return static_cast<u64>(mix_hash(value));
+        }
+        else {
+            const auto high = static_cast<u64>(mix_hash(value));
+            return (high << 32) | static_cast<u64>(mix_hash(value + static_cast<usize>(0x9E3779B9U)));
+        }
+    }
+
     template<typename HEAD, typename... TAIL>
     constexpr auto hash_into(usize& value, HEAD head, TAIL&&... tail) noexcept -> void {
         using Type = std::remove_cv_t<std::remove_reference_t<HEAD>>;
@@ -64,6 +101,19 @@ namespace kstd {
         return result;
     }
 
+    /**
+     * Function object which hashes values using kstd::hash,
+     * this is the default hash function of kstd containers.
+     *
+     * @tparam T The type of the values to hash.
+     */
+    template<typename T>
+    struct Hash final {
+        [[nodiscard]] constexpr auto operator()(const T& value) const noexcept -> usize {
+            return hash(value);
+        }
+    };
+
     template<typename ITERATOR>
     [[nodiscard]] constexpr auto hash_range(ITERATOR begin, ITERATOR end) noexcept -> usize {
         usize result = 0;
@@ -0,0 +1,274 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "defaults.hpp"
+#include "option.hpp"
+#include "reclaim.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    /**
+     * Hazard pointer reclamation domain for lock-free data structures.
+     * Unlike kstd::Epoch, a reader only protects the individual objects it
+     * currently holds, so a slow or blocked reader can never keep more than
+     * its own protected objects alive and memory stays bounded.
+     * Retired objects are kept in per-thread lists which are scanned against
+     * all published hazard pointers once a threshold is reached.
+     */
+    class HazardDomain final {
+        friend class HazardPointer;
+
+        struct alignas(64) Slot final {
+            std::atomic<const void*> pointer {nullptr};
+            std::atomic_bool in_use {true};
+            Slot* next {nullptr};
+        };
+
+        struct Record final {
+            std::atomic_bool in_use {true};
+            std::vector<Retired> retired {};
+            usize collect_at {0};
+            Record* next {nullptr};
+        };
+
+        struct State final {
+            std::atomic<Slot*> slots {nullptr};
+            std::atomic<Record*> records {nullptr};
+            atomic_usize slot_count {0};
+            usize threshold;
+
+            explicit State(usize threshold) noexcept :
+                    threshold {threshold} {
+            }
+
+            ~State() noexcept {
+                for(auto* record = records.load(std::memory_order_acquire); record != nullptr;
+                    record = record->next) {
+                    for(auto& retired : record->retired) {
+                        retired.reclaim();
+                    }
+                }
+                reclamation::destroy(records);
+                reclamation::destroy(slots);
+            }
+
+            inline auto collect(Record& record) noexcept -> usize {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::vector<const void*> hazards {};
+                hazards.reserve(slot_count.load(std::memory_order_relaxed));
+                for(auto* slot = slots.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+                    if(const auto* pointer = slot->pointer.load(std::memory_order_acquire); pointer != nullptr) {
+                        hazards.push_back(pointer);
+                    }
+                }
+                std::sort(hazards.begin(), hazards.end());
+
+                auto& retired = record.retired;
+                const auto safe = std::partition(retired.begin(), retired.end(), [&hazards](const Retired& entry) {
+                    return std::binary_search(hazards.cbegin(), hazards.cend(), entry.get_pointer());
+                });
+                const auto count = static_cast<usize>(retired.end() - safe);
+                for(auto entry = safe; entry != retired.end(); ++entry) {
+                    entry->reclaim();
+                }
+                retired.erase(safe, retired.end());
+                return count;
+            }
+        };
+
+        std::shared_ptr<State> _state;
+
+        [[nodiscard]] inline auto get_record() const noexcept -> Record& {
+            return reclamation::get_record(_state, _state->records);
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(HazardDomain, HazardDomain, inline)
+
+        /**
+         * @param threshold The minimum number of retired objects per thread after which a scan is performed.
+         */
+        explicit HazardDomain(usize threshold = 64) noexcept :
+                _state {std::make_shared<State>(threshold)} {
+        }
+
+        ~HazardDomain() noexcept = default;
+
+        /**
+         * @return The process-wide default hazard pointer domain.
+         */
+        [[nodiscard]] static inline auto get_global() noexcept -> HazardDomain& {
+            static HazardDomain domain {};
+            return domain;
+        }
+
+        /**
+         * Defers the destruction of the given object until no hazard pointer protects it anymore.
+         * The object must already be unreachable from the data structure it was removed from.
+         *
+         * @tparam T The type of the object to retire.
+         * @tparam D The type of the deleter used for reclaiming the object.
+         * @param pointer A pointer to the object to retire.
+         * @param deleter The deleter which is invoked on the object once it is safe to do so.
+         */
+        template<typename T, typename D = std::default_delete<T>>
+        inline auto retire(T* pointer, D deleter = D {}) const noexcept -> void {
+            auto& record = get_record();
+            record.retired.push_back(Retired::make(pointer, std::move(deleter)));
+            if(record.retired.size() >= record.collect_at) {
+                _state->collect(record);
+                // Scan at most once per threshold (and at least 2x the slots) retirements
+                record.collect_at = record.retired.size() +
+                                    std::max(_state->threshold, _state->slot_count.load(std::memory_order_relaxed) * 2);
+            }
+        }
+
+        /**
+         * Reclaims all objects retired by the calling thread which are not protected.
+         *
+         * @return The number of reclaimed objects.
+         */
+        inline auto collect() const noexcept -> usize {
+            return _state->collect(get_record());
+        }
+
+        [[nodiscard]] inline auto get_pending_count() const noexcept -> usize {
+            return get_record().retired.size();
+        }
+    };
+
+    /**
+     * An owned hazard pointer slot of a kstd::HazardDomain.
+     * While an object is protected by the slot, it will not be reclaimed
+     * by any thread retiring it into the same domain.
+     */
+    class HazardPointer final {
+        std::shared_ptr<HazardDomain::State> _state;
+        HazardDomain::Slot* _slot;
+
+        public:
+        KSTD_NO_COPY(HazardPointer, HazardPointer, constexpr)
+
+        explicit HazardPointer(const HazardDomain& domain = HazardDomain::get_global()) noexcept :
+                _state {domain._state},
+                _slot {reclamation::acquire(_state->slots)} {
+            _state->slot_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        HazardPointer(HazardPointer&& other) noexcept :
+                _state {std::move(other._state)},
+                _slot {std::exchange(other._slot, nullptr)} {
+        }
+
+        ~HazardPointer() noexcept {
+            release();
+        }
+
+        auto operator=(HazardPointer&& other) noexcept -> HazardPointer& {
+            if(this != &other) {
+                release();
+                _state = std::move(other._state);
+                _slot = std::exchange(other._slot, nullptr);
+            }
+            return *this;
+        }
+
+        /**
+         * Protects the value currently stored in the given atomic.
+         * Loops until the published hazard matches the value in the atomic,
+         * at which point the object can no longer be reclaimed.
+         *
+         * @tparam T The type of the object to protect.
+         * @param source The atomic to load the object from.
+         * @return The protected pointer, which may be null.
+         */
+        template<typename T>
+        [[nodiscard]] inline auto protect(const std::atomic<T*>& source) noexcept -> T* {
+            auto* pointer = source.load(std::memory_order_relaxed);
+            while(!try_protect(pointer, source)) {
+            }
+            return pointer;
+        }
+
+        /**
+         * Same as protect, but maps null pointers onto an empty option.
+         */
+        template<typename T>
+        [[nodiscard]] inline auto protect_option(const std::atomic<T*>& source) noexcept -> Option<T*> {
+            auto* pointer = protect(source);
+            if(pointer == nullptr) {
+                return {};
+            }
+            return pointer;
+        }
+
+        /**
+         * Tries to protect the given pointer which was loaded from the given atomic.
+         *
+         * @tparam T The type of the object to protect.
+         * @param pointer The pointer to protect, updated to the current value of the source on failure.
+         * @param source The atomic the pointer was loaded from.
+         * @return True if the pointer is protected, false if the source changed in the meantime.
+         */
+        template<typename T>
+        [[nodiscard]] inline auto try_protect(T*& pointer, const std::atomic<T*>& source) noexcept -> bool {
+            _slot->pointer.store(pointer, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto* current = source.load(std::memory_order_acquire);
+            if(current == pointer) {
+                return true;
+            }
+            pointer = current;
+            return false;
+        }
+
+        /**
+         * Protects the given pointer without validating it, the caller has to guarantee
+         * that the object is still reachable after the protection was published.
+         */
+        template<typename T>
+        inline auto reset_protection(T* pointer) noexcept -> void {
+            _slot->pointer.store(pointer, std::memory_order_release);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        inline auto reset_protection() noexcept -> void {
+            _slot->pointer.store(nullptr, std::memory_order_release);
+        }
+
+        inline auto release() noexcept -> void {
+            if(_slot == nullptr) {
+                return;
+            }
+            _slot->pointer.store(nullptr, std::memory_order_release);
+            _slot->in_use.store(false, std::memory_order_release);
+            _state->slot_count.fetch_sub(1, std::memory_order_relaxed);
+            _slot = nullptr;
+            _state.reset();
+        }
+    };
+}// namespace kstd
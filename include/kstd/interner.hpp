@@ -0,0 +1,378 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
+
+#include "assert.hpp"
+#include "bits.hpp"
+#include "box.hpp"
+#include "defaults.hpp"
+#include "hash.hpp"
+#include "non_zero.hpp"
+#include "option.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    /**
+     * A handle to a string deduplicated by a kstd::Interner.
+     * Symbols of the same interner compare and hash by their 32-bit id,
+     * and since the id is never zero, Option<Symbol> is still four bytes.
+     */
+    struct Symbol final {
+        using Self = Symbol;
+
+        friend struct std::hash<Self>;
+
+        private:
+        NonZero<u32> _id;
+
+        [[nodiscard]] constexpr auto get_raw_id() const noexcept -> u32 {
+            return _id.is_empty() ? 0 : _id.get();
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(Symbol, Self, constexpr)
+
+        constexpr Symbol() noexcept :
+                _id {} {
+        }
+
+        explicit constexpr Symbol(u32 id) noexcept :
+                _id {id} {
+        }
+
+        ~Symbol() noexcept = default;
+
+        [[nodiscard]] constexpr auto is_empty() const noexcept -> bool {
+            return _id.is_empty();
+        }
+
+        [[nodiscard]] constexpr auto get_id() const noexcept -> u32 {
+            return _id.get();
+        }
+
+        [[nodiscard]] constexpr auto operator==(const Self& other) const noexcept -> bool {
+            return get_raw_id() == other.get_raw_id();
+        }
+
+        [[nodiscard]] constexpr auto operator!=(const Self& other) const noexcept -> bool {
+            return get_raw_id() != other.get_raw_id();
+        }
+
+        [[nodiscard]] constexpr auto operator<(const Self& other) const noexcept -> bool {
+            return get_raw_id() < other.get_raw_id();
+        }
+    };
+
+    // Specialization for Box so Option<Symbol> uses the zero id as its empty state
+    template<>
+    struct Box<Symbol, void> final {
+        using ValueType = Symbol;
+        using Self = Box<ValueType, void>;
+        using Reference = ValueType&;
+        using ConstReference = const ValueType&;
+        using Pointer = ValueType*;
+        using ConstPointer = const ValueType*;
+
+        private:
+        ValueType _value;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(Box, Self, constexpr)
+
+        constexpr Box() noexcept :
+                _value {} {
+        }
+
+        constexpr Box(ValueType value) noexcept :
+                _value {value} {
+        }
+
+        ~Box() noexcept = default;
+
+        [[nodiscard]] constexpr auto is_empty() const noexcept -> bool {
+            return _value.is_empty();
+        }
+
+        [[nodiscard]] inline auto get() noexcept -> Reference {
+            assert_false(is_empty());
+            return _value;
+        }
+
+        [[nodiscard]] inline auto get() const noexcept -> ConstReference {
+            assert_false(is_empty());
+            return _value;
+        }
+
+        [[nodiscard]] inline auto operator*() noexcept -> Reference {
+            return get();
+        }
+
+        [[nodiscard]] inline auto operator*() const noexcept -> ConstReference {
+            return get();
+        }
+
+        [[nodiscard]] constexpr auto operator==(const Self& other) const noexcept -> bool {
+            return is_empty() == other.is_empty() && (is_empty() || _value == other._value);
+        }
+
+        [[nodiscard]] constexpr auto operator!=(const Self& other) const noexcept -> bool {
+            return !(*this == other);
+        }
+
+        [[nodiscard]] constexpr auto operator==(const ValueType& value) const noexcept -> bool {
+            return !is_empty() && _value == value;
+        }
+
+        [[nodiscard]] constexpr auto operator!=(const ValueType& value) const noexcept -> bool {
+            return is_empty() || _value != value;
+        }
+
+        [[nodiscard]] constexpr operator bool() const noexcept {// NOLINT
+            return !is_empty();
+        }
+    };
+
+    /**
+     * Deduplicates strings into arena memory and hands out kstd::Symbol ids for them.
+     * Interning is sharded by the string's hash, each shard having its own lock,
+     * table and arena, so threads interning different strings rarely contend.
+     * Resolving a symbol back into its string never takes a lock: the strings
+     * are indexed by id through a list of geometrically growing segments which
+     * are never moved once allocated. Interned strings live as long as the interner.
+     */
+    class Interner final {
+        static constexpr usize first_segment_bits = 10;
+        static constexpr usize segment_count = 32;
+        static constexpr usize chunk_size = 16 * 1024;
+        static constexpr usize hash_bits = sizeof(usize) << 3;
+
+        struct Bucket final {
+            u32 id;// Zero marks an empty bucket
+            u32 hash;
+        };
+
+        struct alignas(64) Shard final {
+            mutable std::shared_mutex mutex;
+            std::vector<Bucket> buckets;
+            usize size;
+            std::vector<std::unique_ptr<char[]>> chunks;
+            char* chunk_position;
+            usize chunk_remaining;
+
+            Shard() :
+                    mutex {},
+                    buckets(16, Bucket {0, 0}),
+                    size {0},
+                    chunks {},
+                    chunk_position {nullptr},
+                    chunk_remaining {0} {
+            }
+
+            [[nodiscard]] inline auto allocate(usize size) -> char* {
+                if(size > (chunk_size >> 2)) {
+                    // Large strings get their own allocation, so they don't waste the rest of a chunk
+                    return chunks.emplace_back(std::make_unique<char[]>(size)).get();
+                }
+                if(size > chunk_remaining) {
+                    chunk_position = chunks.emplace_back(std::make_unique<char[]>(chunk_size)).get();
+                    chunk_remaining = chunk_size;
+                }
+                auto* memory = chunk_position;
+                chunk_position += size;
+                chunk_remaining -= size;
+                return memory;
+            }
+        };
+
+        std::unique_ptr<Shard[]> _shards;
+        usize _shard_shift;
+        std::atomic<u32> _next_id;
+        std::array<std::atomic<std::string_view*>, segment_count> _segments;
+
+        [[nodiscard]] static inline auto get_hash(std::string_view value) noexcept -> usize {
+            return mix_hash(std::hash<std::string_view> {}(value));
+        }
+
+        [[nodiscard]] static inline auto get_segment(usize index) noexcept -> usize {
+            return (sizeof(u32) << 3) - 1 - bits::count_leading_zeros(static_cast<u32>((index >> first_segment_bits) + 1));
+        }
+
+        [[nodiscard]] static inline auto get_segment_offset(usize segment) noexcept -> usize {
+            return ((usize {1} << segment) - 1) << first_segment_bits;
+        }
+
+        [[nodiscard]] inline auto get_entry(u32 id) const noexcept -> std::string_view* {
+            const auto index = static_cast<usize>(id - 1);
+            const auto segment = get_segment(index);
+            auto* entries = _segments[segment].load(std::memory_order_acquire);
+            return entries == nullptr ? nullptr : entries + (index - get_segment_offset(segment));
+        }
+
+        [[nodiscard]] inline auto get_or_create_entry(u32 id) -> std::string_view* {
+            const auto index = static_cast<usize>(id - 1);
+            const auto segment = get_segment(index);
+            auto* entries = _segments[segment].load(std::memory_order_acquire);
+            if(entries == nullptr) {
+                auto* created = new std::string_view[usize {1} << (segment + first_segment_bits)];
+                if(_segments[segment].compare_exchange_strong(entries, created, std::memory_order_acq_rel,
+                                                              std::memory_order_acquire)) {
+                    entries = created;
+                }
+                else {
+                    delete[] created;
+                }
+            }
+            return entries + (index - get_segment_offset(segment));
+        }
+
+        [[nodiscard]] inline auto find_in(const Shard& shard, usize hash, std::string_view value) const noexcept
+                -> Option<Symbol> {
+            const auto mask = shard.buckets.size() - 1;
+            for(auto index = hash & mask;; index = (index + 1) & mask) {
+                const auto& bucket = shard.buckets[index];
+                if(bucket.id == 0) {
+                    return {};
+                }
+                if(bucket.hash == static_cast<u32>(hash) && *get_entry(bucket.id) == value) {
+                    return Symbol {bucket.id};
+                }
+            }
+        }
+
+        static inline auto insert_into(std::vector<Bucket>& buckets, Bucket bucket) noexcept -> void {
+            const auto mask = buckets.size() - 1;
+            auto index = bucket.hash & mask;
+            while(buckets[index].id != 0) {
+                index = (index + 1) & mask;
+            }
+            buckets[index] = bucket;
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(Interner, Interner, constexpr)
+
+        /**
+         * @param shard_count The number of independently locked shards, rounded up to a power of two.
+         */
+        explicit Interner(usize shard_count = 16) :
+                _shards {},
+                _shard_shift {hash_bits},
+                _next_id {1},
+                _segments {} {
+            usize count = 1;
+            while(count < shard_count) {
+                count <<= 1;
+                --_shard_shift;
+            }
+            _shards = std::make_unique<Shard[]>(count);
+        }
+
+        ~Interner() noexcept {
+            for(auto& segment : _segments) {
+                delete[] segment.load(std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @return The process-wide default interner.
+         */
+        [[nodiscard]] static inline auto get_global() noexcept -> Interner& {
+            static Interner interner {};
+            return interner;
+        }
+
+        /**
+         * @return The number of distinct strings interned so far.
+         */
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return static_cast<usize>(_next_id.load(std::memory_order_relaxed) - 1);
+        }
+
+        /**
+         * @return The symbol of the given string, if it was interned before.
+         */
+        [[nodiscard]] inline auto find(std::string_view value) const noexcept -> Option<Symbol> {
+            const auto hash = get_hash(value);
+            auto& shard = _shards[_shard_shift == hash_bits ? 0 : hash >> _shard_shift];
+            std::shared_lock lock {shard.mutex};
+            return find_in(shard, hash, value);
+        }
+
+        /**
+         * @return The symbol of the given string, copying the string into the interner if it is new.
+         */
+        [[nodiscard]] inline auto intern(std::string_view value) -> Symbol {
+            const auto hash = get_hash(value);
+            auto& shard = _shards[_shard_shift == hash_bits ? 0 : hash >> _shard_shift];
+            {
+                std::shared_lock lock {shard.mutex};
+                if(auto symbol = find_in(shard, hash, value)) {
+                    return *symbol;
+                }
+            }
+            std::unique_lock lock {shard.mutex};
+            if(auto symbol = find_in(shard, hash, value)) {
+                return *symbol;// Interned by another thread in the meantime
+            }
+
+            const auto id = _next_id.fetch_add(1, std::memory_order_relaxed);
+            assert_true(id != 0);
+            auto* memory = shard.allocate(value.size() + 1);
+            std::memcpy(memory, value.data(), value.size());
+            memory[value.size()] = '\0';
+            *get_or_create_entry(id) = std::string_view {memory, value.size()};
+
+            if((shard.size + 1) * 4 > shard.buckets.size() * 3) {
+                std::vector<Bucket> buckets(shard.buckets.size() << 1, Bucket {0, 0});
+                for(const auto& bucket : shard.buckets) {
+                    if(bucket.id != 0) {
+                        insert_into(buckets, bucket);
+                    }
+                }
+                shard.buckets = std::move(buckets);
+            }
+            insert_into(shard.buckets, {id, static_cast<u32>(hash)});
+            ++shard.size;
+            return Symbol {id};
+        }
+
+        /**
+         * Resolves the given symbol without taking any lock. The symbol must have been
+         * produced by this interner; the returned view is null-terminated and stays
+         * valid for the lifetime of the interner.
+         */
+        [[nodiscard]] inline auto resolve(Symbol symbol) const noexcept -> std::string_view {
+            auto* entry = get_entry(symbol.get_id());
+            assert_true(entry != nullptr);
+            return *entry;
+        }
+    };
+}// namespace kstd
+
+KSTD_DEFAULT_HASH((kstd::Symbol), value._id)
@@ -0,0 +1,566 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "assert.hpp"
+#include "option.hpp"
+#include "slice.hpp"
+#include "static_vector.hpp"
+#include "types.hpp"
+
+/**
+ * Lazy iterator adapters in the style of Rust's iterators.
+ * Every iterator provides a next() function returning an Option of its item,
+ * and adapters wrap their source by value, so a whole chain is a single object
+ * whose next() calls the compiler can inline into a single loop without any
+ * intermediate containers.
+ */
+namespace kstd::iter {
+    template<typename SOURCE, typename F>
+    class Map;
+
+    template<typename SOURCE, typename F>
+    class Filter;
+
+    template<typename FIRST, typename SECOND>
+    class Zip;
+
+    template<typename SOURCE>
+    class Enumerate;
+
+    template<typename SOURCE>
+    class Take;
+
+    template<typename SOURCE>
+    class Skip;
+
+    template<typename SOURCE, typename F>
+    class FlatMap;
+
+    /**
+     * Base class of all iterators providing the adapter and consumer functions.
+     *
+     * @tparam SELF The type of the iterator deriving from this base.
+     */
+    template<typename SELF>
+    class IteratorBase {
+        [[nodiscard]] constexpr auto self() const noexcept -> const SELF& {
+            return static_cast<const SELF&>(*this);
+        }
+
+        public:
+        /**
+         * @return An iterator which yields the results of the given function applied to every item.
+         */
+        template<typename F>
+        [[nodiscard]] constexpr auto map(F function) const noexcept -> Map<SELF, F> {
+            return {self(), std::move(function)};
+        }
+
+        /**
+         * @return An iterator which only yields the items matching the given predicate.
+         */
+        template<typename F>
+        [[nodiscard]] constexpr auto filter(F function) const noexcept -> Filter<SELF, F> {
+            return {self(), std::move(function)};
+        }
+
+        /**
+         * @return An iterator yielding pairs of items from both iterators, until either one is exhausted.
+         */
+        template<typename OTHER>
+        [[nodiscard]] constexpr auto zip(OTHER other) const noexcept -> Zip<SELF, OTHER> {
+            return {self(), std::move(other)};
+        }
+
+        /**
+         * @return An iterator yielding pairs of the index and the item.
+         */
+        [[nodiscard]] constexpr auto enumerate() const noexcept -> Enumerate<SELF> {
+            return Enumerate<SELF> {self()};
+        }
+
+        [[nodiscard]] constexpr auto take(usize count) const noexcept -> Take<SELF> {
+            return {self(), count};
+        }
+
+        [[nodiscard]] constexpr auto skip(usize count) const noexcept -> Skip<SELF> {
+            return {self(), count};
+        }
+
+        /**
+         * @return An iterator yielding all items of the iterators returned by the given function for every item.
+         */
+        template<typename F>
+        [[nodiscard]] constexpr auto flat_map(F function) const noexcept -> FlatMap<SELF, F> {
+            return {self(), std::move(function)};
+        }
+
+        template<typename F>
+        constexpr auto for_each(F&& function) const noexcept -> void {
+            auto source = self();
+            while(auto item = source.next()) {
+                function(std::forward<typename SELF::ItemType>(*item));
+            }
+        }
+
+        template<typename T, typename F>
+        [[nodiscard]] constexpr auto fold(T initial, F&& function) const noexcept -> T {
+            auto source = self();
+            while(auto item = source.next()) {
+                initial = function(std::move(initial), std::forward<typename SELF::ItemType>(*item));
+            }
+            return initial;
+        }
+
+        [[nodiscard]] constexpr auto count() const noexcept -> usize {
+            auto source = self();
+            usize count = 0;
+            while(source.next()) {
+                ++count;
+            }
+            return count;
+        }
+
+        /**
+         * @return The first item matching the given predicate.
+         */
+        template<typename F, typename S = SELF>
+        [[nodiscard]] constexpr auto find(F&& function) const noexcept -> Option<typename S::ItemType> {
+            auto source = self();
+            while(auto item = source.next()) {
+                if(function(std::as_const(*item))) {
+                    return item;
+                }
+            }
+            return {};
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto any(F&& function) const noexcept -> bool {
+            return find(std::forward<F>(function)).has_value();
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto all(F&& function) const noexcept -> bool {
+            return !find([&function](const auto& item) {
+                        return !function(item);
+                    }).has_value();
+        }
+
+        /**
+         * Appends items to the given vector until either the iterator is exhausted or the vector is full.
+         *
+         * @return The number of appended items.
+         */
+        template<typename T, usize SIZE>
+        constexpr auto collect_into(StaticVector<T, SIZE>& vector) const noexcept -> usize {
+            auto source = self();
+            usize count = 0;
+            while(vector.get_size() < vector.get_capacity()) {
+                auto item = source.next();
+                if(!item) {
+                    break;
+                }
+                vector.push_back(std::forward<typename SELF::ItemType>(*item));
+                ++count;
+            }
+            return count;
+        }
+
+        /**
+         * Appends all items to the given vector.
+         *
+         * @return The number of appended items.
+         */
+        template<typename T>
+        inline auto collect_into(std::vector<T>& vector) const -> usize {
+            auto source = self();
+            usize count = 0;
+            while(auto item = source.next()) {
+                vector.push_back(std::forward<typename SELF::ItemType>(*item));
+                ++count;
+            }
+            return count;
+        }
+
+        template<typename S = SELF>
+        [[nodiscard]] inline auto collect() const -> std::vector<std::decay_t<typename S::ItemType>> {
+            std::vector<std::decay_t<typename S::ItemType>> result {};
+            collect_into(result);
+            return result;
+        }
+    };
+
+    /**
+     * Yields references to the elements of a contiguous range.
+     */
+    template<typename T>
+    class SliceIter final : public IteratorBase<SliceIter<T>> {
+        public:
+        using ItemType = T&;
+
+        private:
+        T* _current;
+        T* _end;
+
+        public:
+        constexpr SliceIter(T* begin, T* end) noexcept :
+                _current {begin},
+                _end {end} {
+        }
+
+        [[nodiscard]] constexpr auto next() noexcept -> Option<ItemType> {
+            if(_current == _end) {
+                return {};
+            }
+            return *_current++;
+        }
+    };
+
+    /**
+     * Yields the integers of a half-open interval.
+     */
+    template<typename T>
+    class Range final : public IteratorBase<Range<T>> {
+        public:
+        using ItemType = T;
+
+        private:
+        T _current;
+        T _end;
+
+        public:
+        constexpr Range(T begin, T end) noexcept :
+                _current {begin},
+                _end {end} {
+        }
+
+        [[nodiscard]] constexpr auto next() noexcept -> Option<ItemType> {
+            if(_current >= _end) {
+                return {};
+            }
+            return _current++;
+        }
+    };
+
+    /**
+     * Yields consecutive, non-overlapping sub-slices, the last one may be shorter.
+     */
+    template<typename T>
+    class Chunks final : public IteratorBase<Chunks<T>> {
+        public:
+        using ItemType = Slice<T>;
+
+        private:
+        T* _current;
+        usize _remaining;
+        usize _size;
+
+        public:
+        constexpr Chunks(Slice<T> slice, usize size) noexcept :
+                _current {slice.get_data()},
+                _remaining {slice.get_count()},
+                _size {size} {
+            assert_true(size > 0);
+        }
+
+        [[nodiscard]] constexpr auto next() noexcept -> Option<ItemType> {
+            if(_remaining == 0) {
+                return {};
+            }
+            const auto count = _remaining < _size ? _remaining : _size;
+            Slice<T> chunk {_current, count * sizeof(T)};
+            _current += count;
+            _remaining -= count;
+            return chunk;
+        }
+    };
+
+    /**
+     * Yields all overlapping sub-slices of the given size.
+     */
+    template<typename T>
+    class Windows final : public IteratorBase<Windows<T>> {
+        public:
+        using ItemType = Slice<T>;
+
+        private:
+        T* _current;
+        usize _remaining;
+        usize _size;
+
+        public:
+        constexpr Windows(Slice<T> slice, usize size) noexcept :
+                _current {slice.get_data()},
+                _remaining {slice.get_count()},
+                _size {size} {
+            assert_true(size > 0);
+        }
+
+        [[nodiscard]] constexpr auto next() noexcept -> Option<ItemType> {
+            if(_remaining < _size) {
+                return {};
+            }
+            Slice<T> window {_current, _size * sizeof(T)};
+            ++_current;
+            --_remaining;
+            return window;
+        }
+    };
+
+    template<typename SOURCE, typename F>
+    class Map final : public IteratorBase<Map<SOURCE, F>> {
+        using SourceItemType = typename SOURCE::ItemType;
+
+        public:
+        using ItemType = std::invoke_result_t<F&, SourceItemType>;
+
+        private:
+        SOURCE _source;
+        F _function;
+
+        public:
+        constexpr Map(SOURCE source, F function) noexcept :
+                _source {std::move(source)},
+                _function {std::move(function)} {
+        }
+
+        [[nodiscard]] constexpr auto next() noexcept -> Option<ItemType> {
+            if(auto item = _source.next()) {
+                return _function(std::forward<SourceItemType>(*item));
+            }
+            return {};
+        }
+    };
+
+    template<typename SOURCE, typename F>
+    class Filter final : public IteratorBase<Filter<SOURCE, F>> {
+        public:
+        using ItemType = typename SOURCE::ItemType;
+
+        private:
+        SOURCE _source;
+        F _function;
+
+        public:
+        constexpr Filter(SOURCE source, F function) noexcept :
+                _source {std::move(source)},
+                _function {std::move(function)} {
+        }
+
+        [[nodiscard]] constexpr auto next() noexcept -> Option<ItemType> {
+            while(auto item = _source.next()) {
+                if(_function(std::as_const(*item))) {
+                    return item;
+                }
+            }
+            return {};
+        }
+    };
+
+    template<typename FIRST, typename SECOND>
+    class Zip final : public IteratorBase<Zip<FIRST, SECOND>> {
+        using FirstItemType = typename FIRST::ItemType;
+        using SecondItemType = typename SECOND::ItemType;
+
+        public:
+        using ItemType = std::pair<FirstItemType, SecondItemType>;
+
+        private:
+        FIRST _first;
+        SECOND _second;
+
+        public:
+        constexpr Zip(FIRST first, SECOND second) noexcept :
+                _first {std::move(first)},
+                _second {std::move(second)} {
+        }
+
+        [[nodiscard]] constexpr auto next() noexcept -> Option<ItemType> {
+            auto first = _first.next();
+            if(!first) {
+                return {};
+            }
+            auto second = _second.next();
+            if(!second) {
+                return {};
+            }
+            return ItemType {std::forward<FirstItemType>(*first), std::forward<SecondItemType>(*second)};
+        }
+    };
+
+    template<typename SOURCE>
+    class Enumerate final : public IteratorBase<Enumerate<SOURCE>> {
+        using SourceItemType = typename SOURCE::ItemType;
+
+        public:
+        using ItemType = std::pair<usize, SourceItemType>;
+
+        private:
+        SOURCE _source;
+        usize _index;
+
+        public:
+        explicit constexpr Enumerate(SOURCE source) noexcept :
+                _source {std::move(source)},
+                _index {0} {
+        }
+
+        [[nodiscard]] constexpr auto next() noexcept -> Option<ItemType> {
+            if(auto item = _source.next()) {
+                return ItemType {_index++, std::forward<SourceItemType>(*item)};
+            }
+            return {};
+        }
+    };
+
+    template<typename SOURCE>
+    class Take final : public IteratorBase<Take<SOURCE>> {
+        public:
+        using ItemType = typename SOURCE::ItemType;
+
+        private:
+        SOURCE _source;
+        usize _remaining;
+
+        public:
+        constexpr Take(SOURCE source, usize count) noexcept :
+                _source {std::move(source)},
+                _remaining {count} {
+        }
+
+        [[nodiscard]] constexpr auto next() noexcept -> Option<ItemType> {
+            if(_remaining == 0) {
+                return {};
+            }
+            --_remaining;
+            return _source.next();
+        }
+    };
+
+    template<typename SOURCE>
+    class Skip final : public IteratorBase<Skip<SOURCE>> {
+        public:
+        using ItemType = typename SOURCE::ItemType;
+
+        private:
+        SOURCE _source;
+        usize _count;
+
+        public:
+        constexpr Skip(SOURCE source, usize count) noexcept :
+                _source {std::move(source)},
+                _count {count} {
+        }
+
+        [[nodiscard]] constexpr auto next() noexcept -> Option<ItemType> {
+            for(; _count > 0; --_count) {
+                if(!_source.next()) {
+                    _count = 0;
+                    return {};
+                }
+            }
+            return _source.next();
+        }
+    };
+
+    template<typename SOURCE, typename F>
+    class FlatMap final : public IteratorBase<FlatMap<SOURCE, F>> {
+        using SourceItemType = typename SOURCE::ItemType;
+        using InnerType = std::invoke_result_t<F&, SourceItemType>;
+
+        public:
+        using ItemType = typename InnerType::ItemType;
+
+        private:
+        SOURCE _source;
+        F _function;
+        // Adapters holding lambdas are not assignable, so the inner iterator needs to be re-emplaced
+        std::optional<InnerType> _inner;
+
+        public:
+        constexpr FlatMap(SOURCE source, F function) noexcept :
+                _source {std::move(source)},
+                _function {std::move(function)},
+                _inner {} {
+        }
+
+        [[nodiscard]] constexpr auto next() noexcept -> Option<ItemType> {
+            while(true) {
+                if(_inner) {
+                    if(auto item = _inner->next()) {
+                        return item;
+                    }
+                }
+                auto outer = _source.next();
+                if(!outer) {
+                    return {};
+                }
+                _inner.emplace(_function(std::forward<SourceItemType>(*outer)));
+            }
+        }
+    };
+
+    template<typename T>
+    [[nodiscard]] constexpr auto from(Slice<T> slice) noexcept -> SliceIter<T> {
+        return {slice.get_data(), slice.get_data() + slice.get_count()};
+    }
+
+    template<typename T, usize SIZE>
+    [[nodiscard]] constexpr auto from(StaticVector<T, SIZE>& vector) noexcept -> SliceIter<T> {
+        return {vector.get_data(), vector.get_data() + vector.get_size()};
+    }
+
+    template<typename T, usize SIZE>
+    [[nodiscard]] constexpr auto from(const StaticVector<T, SIZE>& vector) noexcept -> SliceIter<const T> {
+        return {vector.get_data(), vector.get_data() + vector.get_size()};
+    }
+
+    /**
+     * @return An iterator over the elements of a contiguous standard container like std::vector or std::array.
+     */
+    template<typename C>
+    [[nodiscard]] constexpr auto from(C& container) noexcept
+            -> SliceIter<std::remove_pointer_t<decltype(std::data(container))>> {
+        return {std::data(container), std::data(container) + std::size(container)};
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr auto range(T begin, T end) noexcept -> Range<T> {
+        return {begin, end};
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr auto chunks(Slice<T> slice, usize size) noexcept -> Chunks<T> {
+        return {slice, size};
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr auto windows(Slice<T> slice, usize size) noexcept -> Windows<T> {
+        return {slice, size};
+    }
+}// namespace kstd::iter
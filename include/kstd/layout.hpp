@@ -0,0 +1,113 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+
+#include "box.hpp"
+#include "option.hpp"
+#include "result.hpp"
+#include "static_vector.hpp"
+#include "tuple.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    namespace layout {
+        /**
+         * The number of bytes occupied by the known members of a type, excluding any padding.
+         * Types without a specialization are treated as opaque and reported without padding.
+         */
+        template<typename T>
+        struct MemberSize final {
+            static constexpr usize value = sizeof(T);
+        };
+
+        template<typename T>
+        constexpr usize member_size = MemberSize<std::remove_cv_t<T>>::value;
+
+        // Variant based storage needs a one byte discriminator, unless a niche makes it free
+        [[nodiscard]] constexpr auto get_tagged_size(usize size, usize value_size) noexcept -> usize {
+            return size == value_size ? size : value_size + sizeof(u8);
+        }
+
+        template<typename T, typename X>
+        struct MemberSize<Box<T, X>> final {
+            static constexpr usize value = std::is_reference_v<T>
+                                                   ? sizeof(void*)
+                                                   : get_tagged_size(sizeof(Box<T, X>), member_size<T>);
+        };
+
+        template<typename T>
+        struct MemberSize<Option<T>> final {
+            static constexpr usize value = member_size<Box<std::remove_const_t<T>>>;
+        };
+
+        template<typename E>
+        struct MemberSize<Error<E>> final {
+            static constexpr usize value = member_size<E>;
+        };
+
+        template<typename T, typename E>
+        struct MemberSize<Result<T, E>> final {
+            static constexpr usize value = std::max(member_size<Box<T>>, member_size<Error<E>>) + sizeof(u8);
+        };
+
+        template<typename E>
+        struct MemberSize<Result<void, E>> final {
+            static constexpr usize value = member_size<Error<E>> + sizeof(u8);
+        };
+
+        template<typename... TYPES>
+        struct MemberSize<Tuple<TYPES...>> final {
+            static constexpr usize value = (0 + ... + member_size<Box<TYPES>>);
+        };
+
+        template<typename T, usize SIZE>
+        struct MemberSize<StaticVector<T, SIZE>> final {
+            static constexpr usize value = SIZE * member_size<T> + sizeof(usize);
+        };
+    }// namespace layout
+
+    /**
+     * Size, alignment and triviality properties of a type, used for tracking layout budgets.
+     */
+    struct LayoutInfo final {
+        std::string_view name;
+        usize size;
+        usize alignment;
+        usize padding;
+        bool is_trivially_copyable;
+        bool is_trivially_destructible;
+        bool is_standard_layout;
+    };
+
+    template<typename T>
+    [[nodiscard]] constexpr auto get_layout_info(std::string_view name) noexcept -> LayoutInfo {
+        return {name,
+                sizeof(T),
+                alignof(T),
+                sizeof(T) - layout::member_size<T>,
+                std::is_trivially_copyable_v<T>,
+                std::is_trivially_destructible_v<T>,
+                std::is_standard_layout_v<T>};
+    }
+}// namespace kstd
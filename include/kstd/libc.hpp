@@ -75,6 +75,7 @@ namespace kstd::libc {
     using ::strchr;
     using ::strcmp;
     using ::strcpy;
+    using ::strerror;
     using ::strlen;
     using ::strncmp;
     using ::strncpy;
@@ -24,6 +24,81 @@
 #define KSTD_UNPAREN(a) KSTD_LITERAL(KSTD_EXPAND a)
 #define KSTD_TEMPLATE(t) template<KSTD_UNPAREN(t)>
 
+// clang-format off
+#define KSTD_CONCAT_IMPL(a, b) a##b
+#define KSTD_CONCAT(a, b) KSTD_CONCAT_IMPL(a, b)
+
+#define KSTD_ARG_COUNT_IMPL(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, n, ...) n
+#define KSTD_ARG_COUNT(...) KSTD_EXPAND(KSTD_ARG_COUNT_IMPL(__VA_ARGS__, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+
+// Invokes m(d, x) for every x in the given arguments, supports up to 64 arguments
+#define KSTD_FOR_EACH(m, d, ...) KSTD_EXPAND(KSTD_CONCAT(KSTD_FOR_EACH_, KSTD_ARG_COUNT(__VA_ARGS__))(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_1(m, d, x) m(d, x)
+#define KSTD_FOR_EACH_2(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_1(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_3(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_2(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_4(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_3(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_5(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_4(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_6(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_5(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_7(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_6(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_8(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_7(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_9(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_8(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_10(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_9(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_11(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_10(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_12(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_11(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_13(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_12(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_14(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_13(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_15(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_14(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_16(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_15(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_17(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_16(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_18(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_17(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_19(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_18(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_20(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_19(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_21(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_20(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_22(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_21(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_23(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_22(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_24(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_23(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_25(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_24(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_26(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_25(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_27(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_26(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_28(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_27(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_29(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_28(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_30(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_29(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_31(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_30(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_32(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_31(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_33(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_32(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_34(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_33(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_35(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_34(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_36(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_35(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_37(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_36(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_38(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_37(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_39(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_38(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_40(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_39(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_41(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_40(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_42(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_41(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_43(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_42(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_44(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_43(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_45(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_44(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_46(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_45(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_47(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_46(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_48(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_47(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_49(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_48(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_50(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_49(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_51(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_50(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_52(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_51(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_53(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_52(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_54(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_53(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_55(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_54(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_56(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_55(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_57(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_56(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_58(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_57(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_59(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_58(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_60(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_59(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_61(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_60(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_62(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_61(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_63(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_62(m, d, __VA_ARGS__))
+#define KSTD_FOR_EACH_64(m, d, x, ...) m(d, x) KSTD_EXPAND(KSTD_FOR_EACH_63(m, d, __VA_ARGS__))
+// clang-format on
+
 #define KSTD_DEFAULT_DELETER(n, f)                                                                                     \
     struct n final {                                                                                                   \
         template<typename T>                                                                                           \
@@ -0,0 +1,334 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <array>
+#include <fmt/format.h>
+#include <type_traits>
+#include <utility>
+
+#include "defaults.hpp"
+#include "option.hpp"
+#include "result.hpp"
+#include "types.hpp"
+
+#ifdef PLATFORM_LINUX
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif// PLATFORM_LINUX
+
+namespace kstd {
+    enum class PerfCounter : u8 {
+        CYCLES,
+        INSTRUCTIONS,
+        CACHE_MISSES,
+        BRANCH_MISSES
+    };
+
+    constexpr usize perf_counter_count = 4;
+
+    /**
+     * A set of hardware counter values captured by kstd::PerfCounters.
+     * Counters which could not be opened on the current machine are
+     * reported as empty options instead of zero, so callers can tell
+     * "nothing happened" apart from "not measurable here".
+     */
+    struct CounterSnapshot final {
+        using Self = CounterSnapshot;
+        using ValueArray = std::array<u64, perf_counter_count>;
+
+        private:
+        ValueArray _values;
+        u8 _available;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(CounterSnapshot, Self, constexpr)
+
+        constexpr CounterSnapshot() noexcept :
+                _values {},
+                _available {0} {
+        }
+
+        constexpr CounterSnapshot(ValueArray values, u8 available) noexcept :
+                _values {values},
+                _available {available} {
+        }
+
+        ~CounterSnapshot() noexcept = default;
+
+        [[nodiscard]] constexpr auto is_available(PerfCounter counter) const noexcept -> bool {
+            return (_available & (1U << static_cast<u8>(counter))) != 0;
+        }
+
+        [[nodiscard]] constexpr auto is_empty() const noexcept -> bool {
+            return _available == 0;
+        }
+
+        [[nodiscard]] constexpr auto get(PerfCounter counter) const noexcept -> Option<u64> {
+            if(!is_available(counter)) {
+                return {};
+            }
+            return _values[static_cast<u8>(counter)];
+        }
+
+        [[nodiscard]] constexpr auto get_cycles() const noexcept -> Option<u64> {
+            return get(PerfCounter::CYCLES);
+        }
+
+        [[nodiscard]] constexpr auto get_instructions() const noexcept -> Option<u64> {
+            return get(PerfCounter::INSTRUCTIONS);
+        }
+
+        [[nodiscard]] constexpr auto get_cache_misses() const noexcept -> Option<u64> {
+            return get(PerfCounter::CACHE_MISSES);
+        }
+
+        [[nodiscard]] constexpr auto get_branch_misses() const noexcept -> Option<u64> {
+            return get(PerfCounter::BRANCH_MISSES);
+        }
+
+        /**
+         * @return The number of retired instructions per cycle, if both counters are available.
+         */
+        [[nodiscard]] constexpr auto get_ipc() const noexcept -> Option<f64> {
+            if(!is_available(PerfCounter::CYCLES) || !is_available(PerfCounter::INSTRUCTIONS)) {
+                return {};
+            }
+            const auto cycles = _values[static_cast<u8>(PerfCounter::CYCLES)];
+            if(cycles == 0) {
+                return {};
+            }
+            return static_cast<f64>(_values[static_cast<u8>(PerfCounter::INSTRUCTIONS)]) / static_cast<f64>(cycles);
+        }
+
+        /**
+         * @param counter The counter to normalize.
+         * @param operations The number of operations performed while measuring.
+         * @return The average value of the given counter per operation, if available.
+         */
+        [[nodiscard]] constexpr auto get_per_operation(PerfCounter counter, usize operations) const noexcept
+                -> Option<f64> {
+            if(!is_available(counter) || operations == 0) {
+                return {};
+            }
+            return static_cast<f64>(_values[static_cast<u8>(counter)]) / static_cast<f64>(operations);
+        }
+
+        [[nodiscard]] constexpr auto operator-(const Self& other) const noexcept -> Self {
+            ValueArray values {};
+            for(usize index = 0; index < perf_counter_count; ++index) {
+                values[index] = _values[index] - other._values[index];
+            }
+            return {values, static_cast<u8>(_available & other._available)};
+        }
+
+        [[nodiscard]] constexpr auto operator+(const Self& other) const noexcept -> Self {
+            ValueArray values {};
+            for(usize index = 0; index < perf_counter_count; ++index) {
+                values[index] = _values[index] + other._values[index];
+            }
+            return {values, static_cast<u8>(_available & other._available)};
+        }
+    };
+
+    /**
+     * Thin wrapper around the Linux perf_event_open interface which counts
+     * cycles, instructions, cache misses and branch misses of the calling thread.
+     * Every counter is opened individually, so if the kernel or the container
+     * refuses some (or all) of them, the remaining ones keep working and the
+     * missing ones show up as empty values in the resulting snapshots.
+     * On platforms other than Linux no counter is ever available.
+     */
+    class PerfCounters final {
+        using FdArray = std::array<i32, perf_counter_count>;
+
+        FdArray _fds;
+
+#ifdef PLATFORM_LINUX
+        [[nodiscard]] static inline auto open_counter(u64 config) noexcept -> i32 {
+            ::perf_event_attr attributes {};
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.size = sizeof(::perf_event_attr);
+            attributes.config = config;
+            attributes.disabled = 1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            return static_cast<i32>(::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+        }
+
+        [[nodiscard]] inline auto control(unsigned long request) const noexcept -> Result<void> {// NOLINT
+            for(const auto fd : _fds) {
+                if(fd < 0) {
+                    continue;
+                }
+                if(::ioctl(fd, request, 0) < 0) {
+                    return Error {fmt::format("Could not control perf counter: {}", libc::strerror(errno))};
+                }
+            }
+            return {};
+        }
+#endif// PLATFORM_LINUX
+
+        explicit PerfCounters(FdArray fds) noexcept :
+                _fds {fds} {
+        }
+
+        public:
+        KSTD_NO_COPY(PerfCounters, PerfCounters, constexpr)
+
+        PerfCounters() noexcept :
+                _fds {-1, -1, -1, -1} {
+        }
+
+        PerfCounters(PerfCounters&& other) noexcept :
+                _fds {std::exchange(other._fds, {-1, -1, -1, -1})} {
+        }
+
+        ~PerfCounters() noexcept {
+            close();
+        }
+
+        auto operator=(PerfCounters&& other) noexcept -> PerfCounters& {
+            if(this != &other) {
+                close();
+                _fds = std::exchange(other._fds, {-1, -1, -1, -1});
+            }
+            return *this;
+        }
+
+        /**
+         * Opens all supported hardware counters for the calling thread.
+         * This never fails; counters which are unavailable are simply not reported.
+         *
+         * @return A new set of (disabled) counters.
+         */
+        [[nodiscard]] static inline auto open() noexcept -> PerfCounters {
+#ifdef PLATFORM_LINUX
+            return PerfCounters({open_counter(PERF_COUNT_HW_CPU_CYCLES), open_counter(PERF_COUNT_HW_INSTRUCTIONS),
+                                 open_counter(PERF_COUNT_HW_CACHE_MISSES),
+                                 open_counter(PERF_COUNT_HW_BRANCH_MISSES)});
+#else
+            return {};
+#endif// PLATFORM_LINUX
+        }
+
+        [[nodiscard]] inline auto is_available(PerfCounter counter) const noexcept -> bool {
+            return _fds[static_cast<u8>(counter)] >= 0;
+        }
+
+        [[nodiscard]] inline auto has_any() const noexcept -> bool {
+            for(const auto fd : _fds) {
+                if(fd >= 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        inline auto close() noexcept -> void {
+            for(auto& fd : _fds) {
+                if(fd < 0) {
+                    continue;
+                }
+#ifdef PLATFORM_LINUX
+                ::close(fd);
+#endif// PLATFORM_LINUX
+                fd = -1;
+            }
+        }
+
+        /**
+         * Resets all available counters to zero and starts counting.
+         */
+        [[nodiscard]] inline auto start() noexcept -> Result<void> {
+#ifdef PLATFORM_LINUX
+            if(auto result = control(PERF_EVENT_IOC_RESET); !result) {
+                return result;
+            }
+            return control(PERF_EVENT_IOC_ENABLE);
+#else
+            return {};
+#endif// PLATFORM_LINUX
+        }
+
+        [[nodiscard]] inline auto stop() noexcept -> Result<void> {
+#ifdef PLATFORM_LINUX
+            return control(PERF_EVENT_IOC_DISABLE);
+#else
+            return {};
+#endif// PLATFORM_LINUX
+        }
+
+        /**
+         * Reads the current value of all available counters.
+         * If the kernel had to multiplex a counter, its value is
+         * scaled up to the full time it was enabled.
+         */
+        [[nodiscard]] inline auto read() const noexcept -> Result<CounterSnapshot> {
+            CounterSnapshot::ValueArray values {};
+            u8 available = 0;
+#ifdef PLATFORM_LINUX
+            for(usize index = 0; index < perf_counter_count; ++index) {
+                const auto fd = _fds[index];
+                if(fd < 0) {
+                    continue;
+                }
+                std::array<u64, 3> buffer {};// value, time enabled, time running
+                if(::read(fd, buffer.data(), sizeof(buffer)) != static_cast<isize>(sizeof(buffer))) {
+                    return Error {fmt::format("Could not read perf counter: {}", libc::strerror(errno))};
+                }
+                if(buffer[2] == 0) {
+                    continue;// Never scheduled, no meaningful value
+                }
+                values[index] = buffer[1] == buffer[2] ? buffer[0]
+                                                       : static_cast<u64>(static_cast<f64>(buffer[0]) *
+                                                                          static_cast<f64>(buffer[1]) /
+                                                                          static_cast<f64>(buffer[2]));
+                available |= static_cast<u8>(1U << index);
+            }
+#endif// PLATFORM_LINUX
+            return CounterSnapshot {values, available};
+        }
+
+        /**
+         * Measures the counters over the invocation of the given function.
+         *
+         * @tparam F The type of the function to measure.
+         * @param function The function to measure.
+         * @return The counter values collected while the function was running.
+         */
+        template<typename F>
+        [[nodiscard]] inline auto measure(F&& function) noexcept -> Result<CounterSnapshot> {
+            static_assert(std::is_invocable_v<F>, "Function must be invocable without parameters");
+            if(auto result = start(); !result) {
+                return result.template forward<CounterSnapshot>();
+            }
+            std::forward<F>(function)();
+            if(auto result = stop(); !result) {
+                return result.template forward<CounterSnapshot>();
+            }
+            return read();
+        }
+    };
+}// namespace kstd
@@ -0,0 +1,487 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <cstring>
+#include <fmt/format.h>
+#include <vector>
+
+#include "assert.hpp"
+#include "defaults.hpp"
+#include "hash.hpp"
+#include "result.hpp"
+#include "slice.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    /**
+     * A quotient filter (Bender et al.), an approximate membership structure
+     * which, unlike a Bloom filter, supports removing keys and merging filters.
+     * The fingerprint of a key is split into a quotient, which selects the
+     * canonical slot, and a remainder which is stored in the slot together
+     * with three metadata bits. Slots are bit-packed, so the filter uses
+     * remainder_bits + 3 bits per slot.
+     *
+     * Removing a key which was never inserted may remove another key with the
+     * same fingerprint, so only keys which are known to be present should be removed.
+     */
+    class QuotientFilter final {
+        static constexpr u32 magic = 0x4651544B;// "KTQF"
+        static constexpr u32 version = 1;
+
+        static constexpr u64 occupied_bit = 1;
+        static constexpr u64 continuation_bit = 2;
+        static constexpr u64 shifted_bit = 4;
+        static constexpr u64 metadata_mask = 7;
+
+        struct Header final {
+            u32 magic;
+            u32 version;
+            u32 quotient_bits;
+            u32 remainder_bits;
+            u64 size;
+        };
+
+        u32 _quotient_bits;
+        u32 _remainder_bits;
+        u32 _slot_bits;
+        u64 _slot_mask;
+        u64 _index_mask;
+        usize _size;
+        std::vector<u64> _words;
+
+        [[nodiscard]] static constexpr auto get_word_count(u32 quotient_bits, u32 slot_bits) noexcept -> u64 {
+            // One padding word, so slots straddling the last word can always read their upper half
+            return (((u64 {1} << quotient_bits) * slot_bits + 63) >> 6) + 1;
+        }
+
+        [[nodiscard]] static constexpr auto is_empty_slot(u64 slot) noexcept -> bool {
+            return (slot & metadata_mask) == 0;
+        }
+
+        [[nodiscard]] static constexpr auto is_cluster_start(u64 slot) noexcept -> bool {
+            return (slot & metadata_mask) == occupied_bit;
+        }
+
+        [[nodiscard]] static constexpr auto is_run_start(u64 slot) noexcept -> bool {
+            return (slot & continuation_bit) == 0 && (slot & (occupied_bit | shifted_bit)) != 0;
+        }
+
+        [[nodiscard]] inline auto get_slot(u64 index) const noexcept -> u64 {
+            const auto bit = index * _slot_bits;
+            const auto word = bit >> 6;
+            const auto offset = bit & 63;
+            auto value = _words[word] >> offset;
+            if(offset + _slot_bits > 64) {
+                value |= _words[word + 1] << (64 - offset);
+            }
+            return value & _slot_mask;
+        }
+
+        inline auto set_slot(u64 index, u64 value) noexcept -> void {
+            const auto bit = index * _slot_bits;
+            const auto word = bit >> 6;
+            const auto offset = bit & 63;
+            _words[word] = (_words[word] & ~(_slot_mask << offset)) | (value << offset);
+            if(offset + _slot_bits > 64) {
+                const auto shift = 64 - offset;
+                _words[word + 1] = (_words[word + 1] & ~(_slot_mask >> shift)) | (value >> shift);
+            }
+        }
+
+        [[nodiscard]] inline auto next(u64 index) const noexcept -> u64 {
+            return (index + 1) & _index_mask;
+        }
+
+        [[nodiscard]] inline auto previous(u64 index) const noexcept -> u64 {
+            return (index - 1) & _index_mask;
+        }
+
+        /**
+         * @return The index of the first slot of the run belonging to the given quotient.
+         */
+        [[nodiscard]] inline auto find_run(u64 quotient) const noexcept -> u64 {
+            auto bucket = quotient;
+            while((get_slot(bucket) & shifted_bit) != 0) {
+                bucket = previous(bucket);
+            }
+            auto run = bucket;
+            while(bucket != quotient) {
+                do {
+                    run = next(run);
+                } while((get_slot(run) & continuation_bit) != 0);
+                do {
+                    bucket = next(bucket);
+                } while((get_slot(bucket) & occupied_bit) == 0);
+            }
+            return run;
+        }
+
+        /**
+         * Inserts the given slot value at the given index, shifting the following slots
+         * of the cluster up by one while keeping the occupied bits at their slots.
+         */
+        inline auto shift_in(u64 index, u64 value) noexcept -> void {
+            auto current = value;
+            bool empty = false;
+            do {
+                auto previous_value = get_slot(index);
+                empty = is_empty_slot(previous_value);
+                if(!empty) {
+                    previous_value |= shifted_bit;
+                    if((previous_value & occupied_bit) != 0) {
+                        current |= occupied_bit;
+                        previous_value &= ~occupied_bit;
+                    }
+                }
+                set_slot(index, current);
+                current = previous_value;
+                index = next(index);
+            } while(!empty);
+        }
+
+        /**
+         * Removes the slot at the given index, shifting the following slots of the cluster down by one.
+         */
+        inline auto shift_out(u64 index, u64 quotient) noexcept -> void {
+            auto current = get_slot(index);
+            auto following = next(index);
+            const auto origin = index;
+            while(true) {
+                const auto next_value = get_slot(following);
+                const auto current_occupied = (current & occupied_bit) != 0;
+                if(is_empty_slot(next_value) || is_cluster_start(next_value) || following == origin) {
+                    set_slot(index, 0);
+                    return;
+                }
+                auto updated = next_value;
+                if(is_run_start(next_value)) {
+                    do {
+                        quotient = next(quotient);
+                    } while((get_slot(quotient) & occupied_bit) == 0);
+                    if(current_occupied && quotient == index) {
+                        updated &= ~shifted_bit;
+                    }
+                }
+                set_slot(index, current_occupied ? (updated | occupied_bit) : (updated & ~occupied_bit));
+                index = following;
+                following = next(following);
+                current = next_value;
+            }
+        }
+
+        [[nodiscard]] inline auto get_fingerprint(u64 hash) const noexcept -> u64 {
+            const auto bits = _quotient_bits + _remainder_bits;
+            return bits == 64 ? hash : hash & ((u64 {1} << bits) - 1);
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(QuotientFilter, QuotientFilter, inline)
+
+        /**
+         * @param quotient_bits The base two logarithm of the number of slots.
+         * @param remainder_bits The number of fingerprint bits stored per slot, the false
+         *                       positive rate is roughly 2^-remainder_bits at full load.
+         */
+        QuotientFilter(u32 quotient_bits, u32 remainder_bits) :
+                _quotient_bits {quotient_bits},
+                _remainder_bits {remainder_bits},
+                _slot_bits {remainder_bits + 3},
+                _slot_mask {(u64 {1} << (remainder_bits + 3)) - 1},
+                _index_mask {(u64 {1} << quotient_bits) - 1},
+                _size {0},
+                _words {} {
+            assert_true(quotient_bits > 0 && remainder_bits > 0 && remainder_bits <= 60);
+            assert_true(quotient_bits + remainder_bits <= 64 && quotient_bits < 48);
+            _words.resize(static_cast<usize>(get_word_count(quotient_bits, _slot_bits)), 0);
+        }
+
+        ~QuotientFilter() noexcept = default;
+
+        [[nodiscard]] inline auto get_quotient_bits() const noexcept -> u32 {
+            return _quotient_bits;
+        }
+
+        [[nodiscard]] inline auto get_remainder_bits() const noexcept -> u32 {
+            return _remainder_bits;
+        }
+
+        [[nodiscard]] inline auto get_slot_count() const noexcept -> usize {
+            return static_cast<usize>(_index_mask + 1);
+        }
+
+        /**
+         * @return The number of distinct fingerprints stored in the filter.
+         */
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _size;
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return _size == 0;
+        }
+
+        [[nodiscard]] inline auto get_load_factor() const noexcept -> f64 {
+            return static_cast<f64>(_size) / static_cast<f64>(get_slot_count());
+        }
+
+        /**
+         * Inserts the given hash, failing if no slot is left.
+         * At least one slot always stays empty, so lookups are guaranteed to terminate.
+         */
+        [[nodiscard]] inline auto insert_hash(u64 hash) noexcept -> Result<void> {
+            const auto fingerprint = get_fingerprint(hash);
+            const auto quotient = fingerprint >> _remainder_bits;
+            const auto remainder = fingerprint & (_slot_mask >> 3);
+            const auto canonical = get_slot(quotient);
+            auto entry = remainder << 3;
+
+            if(_size + 1 >= get_slot_count()) {
+                return Error {fmt::format("Quotient filter with {} slots is full", get_slot_count())};
+            }
+            if(is_empty_slot(canonical)) {
+                set_slot(quotient, entry | occupied_bit);
+                ++_size;
+                return {};
+            }
+            const auto was_occupied = (canonical & occupied_bit) != 0;
+            if(!was_occupied) {
+                set_slot(quotient, canonical | occupied_bit);
+            }
+
+            const auto start = find_run(quotient);
+            auto index = start;
+            if(was_occupied) {
+                // Runs are sorted by remainder, find the insert position
+                do {
+                    const auto current = get_slot(index) >> 3;
+                    if(current == remainder) {
+                        return {};
+                    }
+                    if(current > remainder) {
+                        break;
+                    }
+                    index = next(index);
+                } while((get_slot(index) & continuation_bit) != 0);
+
+                if(index == start) {
+                    set_slot(start, get_slot(start) | continuation_bit);
+                }
+                else {
+                    entry |= continuation_bit;
+                }
+            }
+            if(index != quotient) {
+                entry |= shifted_bit;
+            }
+            shift_in(index, entry);
+            ++_size;
+            return {};
+        }
+
+        [[nodiscard]] inline auto contains_hash(u64 hash) const noexcept -> bool {
+            const auto fingerprint = get_fingerprint(hash);
+            const auto quotient = fingerprint >> _remainder_bits;
+            const auto remainder = fingerprint & (_slot_mask >> 3);
+            if((get_slot(quotient) & occupied_bit) == 0) {
+                return false;
+            }
+            auto index = find_run(quotient);
+            do {
+                const auto current = get_slot(index) >> 3;
+                if(current == remainder) {
+                    return true;
+                }
+                if(current > remainder) {
+                    return false;
+                }
+                index = next(index);
+            } while((get_slot(index) & continuation_bit) != 0);
+            return false;
+        }
+
+        /**
+         * @return True if the fingerprint of the given hash was found and removed.
+         */
+        inline auto remove_hash(u64 hash) noexcept -> bool {
+            const auto fingerprint = get_fingerprint(hash);
+            const auto quotient = fingerprint >> _remainder_bits;
+            const auto remainder = fingerprint & (_slot_mask >> 3);
+            auto canonical = get_slot(quotient);
+            if((canonical & occupied_bit) == 0 || _size == 0) {
+                return false;
+            }
+
+            const auto start = find_run(quotient);
+            auto index = start;
+            auto current = u64 {0};
+            do {
+                current = get_slot(index) >> 3;
+                if(current >= remainder) {
+                    break;
+                }
+                index = next(index);
+            } while((get_slot(index) & continuation_bit) != 0);
+            if(current != remainder) {
+                return false;
+            }
+
+            const auto removed = index == quotient ? canonical : get_slot(index);
+            const auto was_run_start = is_run_start(removed);
+            if(was_run_start && (get_slot(next(index)) & continuation_bit) == 0) {
+                // Removing the only fingerprint of this quotient
+                canonical &= ~occupied_bit;
+                set_slot(quotient, get_slot(quotient) & ~occupied_bit);
+            }
+
+            shift_out(index, quotient);
+
+            if(was_run_start) {
+                const auto value = get_slot(index);
+                auto updated = value & ~continuation_bit;
+                if(index == quotient && is_run_start(updated)) {
+                    updated &= ~shifted_bit;
+                }
+                if(updated != value) {
+                    set_slot(index, updated);
+                }
+            }
+            --_size;
+            return true;
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto insert(const T& value) noexcept -> Result<void> {
+            return insert_hash(mix_hash64(hash(value)));
+        }
+
+        /**
+         * @return False if the value was definitely never inserted, true if it probably was.
+         */
+        template<typename T>
+        [[nodiscard]] inline auto contains(const T& value) const noexcept -> bool {
+            return contains_hash(mix_hash64(hash(value)));
+        }
+
+        template<typename T>
+        inline auto remove(const T& value) noexcept -> bool {
+            return remove_hash(mix_hash64(hash(value)));
+        }
+
+        inline auto clear() noexcept -> void {
+            std::fill(_words.begin(), _words.end(), 0);
+            _size = 0;
+        }
+
+        /**
+         * Invokes the given function with every stored fingerprint (quotient and remainder combined).
+         */
+        template<typename F>
+        inline auto for_each_fingerprint(F&& function) const -> void {
+            if(_size == 0) {
+                return;
+            }
+            u64 index = 0;
+            while(!is_cluster_start(get_slot(index))) {
+                index = next(index);
+            }
+            auto quotient = index;
+            for(usize visited = 0; visited < _size; index = next(index)) {
+                const auto slot = get_slot(index);
+                if(is_cluster_start(slot)) {
+                    quotient = index;
+                }
+                else if(is_run_start(slot)) {
+                    do {
+                        quotient = next(quotient);
+                    } while((get_slot(quotient) & occupied_bit) == 0);
+                }
+                if(!is_empty_slot(slot)) {
+                    function((quotient << _remainder_bits) | (slot >> 3));
+                    ++visited;
+                }
+            }
+        }
+
+        /**
+         * Inserts all fingerprints of the given filter, which needs to use the same fingerprint layout.
+         */
+        [[nodiscard]] inline auto merge(const QuotientFilter& other) noexcept -> Result<void> {
+            if(other._quotient_bits != _quotient_bits || other._remainder_bits != _remainder_bits) {
+                return Error {fmt::format("Cannot merge quotient filter with {}/{} bits into one with {}/{} bits",
+                                          other._quotient_bits, other._remainder_bits, _quotient_bits,
+                                          _remainder_bits)};
+            }
+            Result<void> result {};
+            other.for_each_fingerprint([&](u64 fingerprint) {
+                if(result) {
+                    result = insert_hash(fingerprint);
+                }
+            });
+            return result;
+        }
+
+        [[nodiscard]] inline auto get_serialized_size() const noexcept -> usize {
+            return sizeof(Header) + _words.size() * sizeof(u64);
+        }
+
+        /**
+         * Writes the filter in native byte order into the given buffer.
+         *
+         * @return The number of bytes written.
+         */
+        [[nodiscard]] inline auto serialize(Slice<u8> buffer) const noexcept -> Result<usize> {
+            const auto size = get_serialized_size();
+            if(buffer.get_size() < size) {
+                return Error {fmt::format("Buffer of {} bytes is too small, {} bytes are required",
+                                          buffer.get_size(), size)};
+            }
+            const Header header {magic, version, _quotient_bits, _remainder_bits, _size};
+            std::memcpy(buffer.get_data(), &header, sizeof(Header));
+            std::memcpy(buffer.get_data() + sizeof(Header), _words.data(), _words.size() * sizeof(u64));
+            return size;
+        }
+
+        [[nodiscard]] static inline auto deserialize(Slice<const u8> buffer) -> Result<QuotientFilter> {
+            if(buffer.get_size() < sizeof(Header)) {
+                return Error {std::string {"Buffer is too small to contain a quotient filter"}};
+            }
+            Header header {};
+            std::memcpy(&header, buffer.get_data(), sizeof(Header));
+            if(header.magic != magic || header.version != version || header.quotient_bits == 0 ||
+               header.quotient_bits >= 48 || header.remainder_bits == 0 || header.remainder_bits > 60 ||
+               header.quotient_bits + header.remainder_bits > 64) {
+                return Error {std::string {"Buffer does not contain a compatible quotient filter"}};
+            }
+            if(header.size > (u64 {1} << header.quotient_bits)) {
+                return Error {fmt::format("Quotient filter size {} exceeds its slot count", header.size)};
+            }
+            // Validate the payload length before allocating anything based on the header
+            const auto word_count = get_word_count(header.quotient_bits, header.remainder_bits + 3);
+            if(static_cast<u64>(buffer.get_size() - sizeof(Header)) / sizeof(u64) < word_count) {
+                return Error {fmt::format("Buffer is truncated, expected {} words", word_count)};
+            }
+            QuotientFilter filter {header.quotient_bits, header.remainder_bits};
+            std::memcpy(filter._words.data(), buffer.get_data() + sizeof(Header), filter._words.size() * sizeof(u64));
+            filter._size = static_cast<usize>(header.size);
+            return filter;
+        }
+    };
+}// namespace kstd
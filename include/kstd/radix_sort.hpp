@@ -0,0 +1,451 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "defaults.hpp"
+#include "result.hpp"
+#include "slice.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+namespace kstd {
+    /**
+     * Maps keys onto unsigned integers with the same ordering, so they can be
+     * sorted digit by digit. Specialize this for custom key types, or use
+     * kstd::radix_sort_by_key to sort by an arithmetic key of each element.
+     *
+     * @tparam T The type of the key.
+     */
+    template<typename T, typename = void>
+    struct RadixKey;
+
+    template<typename T>
+    struct RadixKey<T, std::enable_if_t<std::is_unsigned_v<T>>> final {
+        using BitsType = T;
+
+        [[nodiscard]] static constexpr auto to_bits(T value) noexcept -> BitsType {
+            return value;
+        }
+    };
+
+    template<typename T>
+    struct RadixKey<T, std::enable_if_t<std::is_integral_v<T> && std::is_signed_v<T>>> final {
+        using BitsType = std::make_unsigned_t<T>;
+
+        [[nodiscard]] static constexpr auto to_bits(T value) noexcept -> BitsType {
+            constexpr auto sign_bit = static_cast<BitsType>(BitsType {1} << (sizeof(T) * 8 - 1));
+            return static_cast<BitsType>(static_cast<BitsType>(value) ^ sign_bit);
+        }
+    };
+
+    template<typename T>
+    struct RadixKey<T, std::enable_if_t<std::is_floating_point_v<T>>> final {
+        static_assert(sizeof(T) == sizeof(u32) || sizeof(T) == sizeof(u64), "Unsupported floating point type");
+        using BitsType = std::conditional_t<sizeof(T) == sizeof(u32), u32, u64>;
+
+        /**
+         * Orders floats by their IEEE-754 total order, which puts -0 before +0
+         * and NaNs at either end depending on their sign.
+         */
+        [[nodiscard]] static inline auto to_bits(T value) noexcept -> BitsType {
+            constexpr auto sign_bit = static_cast<BitsType>(BitsType {1} << (sizeof(T) * 8 - 1));
+            BitsType bits {};
+            std::memcpy(&bits, &value, sizeof(T));
+            return (bits & sign_bit) != 0 ? static_cast<BitsType>(~bits) : static_cast<BitsType>(bits | sign_bit);
+        }
+    };
+}// namespace kstd
+
+namespace kstd::sorting {
+    constexpr usize radix_bucket_count = 256;
+    constexpr usize prefetch_distance = 16;
+    constexpr usize string_insertion_threshold = 32;
+
+    using Histogram = std::array<usize, radix_bucket_count>;
+
+    template<typename BITS>
+    [[nodiscard]] constexpr auto get_digit(BITS bits, usize digit) noexcept -> usize {
+        return static_cast<usize>((bits >> (digit * 8)) & 0xFF);
+    }
+
+    /**
+     * @return True if all elements end up in the same bucket, in which case the pass can be skipped.
+     */
+    [[nodiscard]] inline auto is_trivial_pass(const Histogram& histogram, usize count) noexcept -> bool {
+        return std::any_of(histogram.begin(), histogram.end(), [count](usize bucket_count) {
+            return bucket_count == count;
+        });
+    }
+
+    /**
+     * Reusable barrier which lets the threads of a parallel sort wait for each other between phases.
+     */
+    class PassBarrier final {
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        usize _count;
+        usize _waiting;
+        usize _generation;
+
+        public:
+        KSTD_NO_MOVE_COPY(PassBarrier, PassBarrier, inline)
+
+        explicit PassBarrier(usize count) noexcept :
+                _mutex {},
+                _condition {},
+                _count {count},
+                _waiting {0},
+                _generation {0} {
+        }
+
+        ~PassBarrier() noexcept = default;
+
+        inline auto arrive_and_wait() -> void {
+            std::unique_lock lock {_mutex};
+            const auto generation = _generation;
+            if(++_waiting == _count) {
+                _waiting = 0;
+                ++_generation;
+                _condition.notify_all();
+                return;
+            }
+            _condition.wait(lock, [&] {
+                return _generation != generation;
+            });
+        }
+    };
+
+    /**
+     * Moves every element to the next free slot of its bucket. The input is read sequentially,
+     * which the hardware prefetcher already covers, but the writes jump between up to 256 buckets,
+     * so the destination slot of an element a few iterations ahead is prefetched instead.
+     */
+    template<typename T, typename KEY>
+    inline auto scatter(T* source, T* destination, usize begin, usize end, Histogram& offsets, usize digit,
+                        KEY& key) -> void {
+        for(usize index = begin; index < end; ++index) {
+            if(index + prefetch_distance < end) {
+                utils::prefetch_write(destination + offsets[get_digit(key(source[index + prefetch_distance]), digit)]);
+            }
+            const auto bucket = get_digit(key(source[index]), digit);
+            destination[offsets[bucket]++] = std::move(source[index]);
+        }
+    }
+
+    template<typename T, typename KEY>
+    inline auto lsd_sort(T* values, T* scratch, usize count, KEY& key) -> void {
+        using BitsType = std::decay_t<std::invoke_result_t<KEY&, const T&>>;
+        constexpr usize digit_count = sizeof(BitsType);
+
+        // A single pass over the input collects the histograms of all digits
+        std::array<Histogram, digit_count> histograms {};
+        for(usize index = 0; index < count; ++index) {
+            const auto bits = key(values[index]);
+            for(usize digit = 0; digit < digit_count; ++digit) {
+                ++histograms[digit][get_digit(bits, digit)];
+            }
+        }
+
+        auto* source = values;
+        auto* destination = scratch;
+        for(usize digit = 0; digit < digit_count; ++digit) {
+            auto& histogram = histograms[digit];
+            if(is_trivial_pass(histogram, count)) {
+                continue;
+            }
+            usize offset = 0;
+            for(auto& bucket_count : histogram) {
+                offset += std::exchange(bucket_count, offset);
+            }
+            scatter(source, destination, 0, count, histogram, digit, key);
+            std::swap(source, destination);
+        }
+        if(source != values) {
+            std::move(source, source + count, values);
+        }
+    }
+
+    /**
+     * Every thread counts and scatters its own contiguous chunk of the input.
+     * Within every bucket, the chunks are laid out in thread order, which keeps the sort stable.
+     * The threads are started once and run all passes, synchronizing through a barrier
+     * between counting, computing the offsets and scattering.
+     */
+    template<typename T, typename KEY>
+    inline auto parallel_lsd_sort(T* values, T* scratch, usize count, KEY& key, usize thread_count) -> void {
+        using BitsType = std::decay_t<std::invoke_result_t<KEY&, const T&>>;
+        constexpr usize digit_count = sizeof(BitsType);
+
+        const auto chunk_size = (count + thread_count - 1) / thread_count;
+        std::vector<Histogram> histograms(thread_count);
+        PassBarrier barrier {thread_count};
+        bool skip_pass = false;
+
+        const auto run = [&](usize thread) {
+            const auto begin = std::min(thread * chunk_size, count);
+            const auto end = std::min(begin + chunk_size, count);
+            auto& histogram = histograms[thread];
+            auto* source = values;
+            auto* destination = scratch;
+            for(usize digit = 0; digit < digit_count; ++digit) {
+                histogram.fill(0);
+                for(usize index = begin; index < end; ++index) {
+                    ++histogram[get_digit(key(source[index]), digit)];
+                }
+                barrier.arrive_and_wait();
+
+                if(thread == 0) {
+                    Histogram totals {};
+                    for(const auto& current : histograms) {
+                        for(usize bucket = 0; bucket < radix_bucket_count; ++bucket) {
+                            totals[bucket] += current[bucket];
+                        }
+                    }
+                    skip_pass = is_trivial_pass(totals, count);
+                    usize offset = 0;
+                    for(usize bucket = 0; bucket < radix_bucket_count && !skip_pass; ++bucket) {
+                        for(auto& current : histograms) {
+                            offset += std::exchange(current[bucket], offset);
+                        }
+                    }
+                }
+                barrier.arrive_and_wait();
+                if(skip_pass) {
+                    continue;
+                }
+
+                scatter(source, destination, begin, end, histogram, digit, key);
+                barrier.arrive_and_wait();
+                std::swap(source, destination);
+            }
+            if(thread == 0 && source != values) {
+                std::move(source, source + count, values);
+            }
+        };
+
+        std::vector<std::thread> threads {};
+        threads.reserve(thread_count - 1);
+        for(usize thread = 1; thread < thread_count; ++thread) {
+            threads.emplace_back(run, thread);
+        }
+        run(0);
+        for(auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    [[nodiscard]] inline auto get_string_bucket(std::string_view value, usize depth) noexcept -> usize {
+        return depth < value.size() ? static_cast<usize>(static_cast<u8>(value[depth])) + 1 : 0;
+    }
+
+    /**
+     * Distributes the given strings by the byte at the given depth into 257 buckets,
+     * the first one holding all strings which end before that depth.
+     *
+     * @return The offset of every bucket, followed by the total count.
+     */
+    inline auto distribute_strings(std::string_view* values, std::string_view* scratch, usize count, usize depth)
+            -> std::array<usize, radix_bucket_count + 2> {
+        std::array<usize, radix_bucket_count + 2> offsets {};
+        for(usize index = 0; index < count; ++index) {
+            if(index + prefetch_distance < count) {
+                const auto& ahead = values[index + prefetch_distance];
+                if(depth < ahead.size()) {
+                    utils::prefetch(ahead.data() + depth);
+                }
+            }
+            ++offsets[get_string_bucket(values[index], depth) + 1];
+        }
+        for(usize bucket = 1; bucket < offsets.size(); ++bucket) {
+            offsets[bucket] += offsets[bucket - 1];
+        }
+        auto positions = offsets;
+        for(usize index = 0; index < count; ++index) {
+            if(index + prefetch_distance < count) {
+                utils::prefetch_write(scratch + positions[get_string_bucket(values[index + prefetch_distance], depth)]);
+            }
+            scratch[positions[get_string_bucket(values[index], depth)]++] = values[index];
+        }
+        std::copy(scratch, scratch + count, values);
+        return offsets;
+    }
+
+    inline auto msd_sort(std::string_view* values, std::string_view* scratch, usize count, usize depth) -> void {
+        while(count >= string_insertion_threshold) {
+            const auto offsets = distribute_strings(values, scratch, count, depth);
+            ++depth;
+            // Continue with the largest bucket in this loop and recurse into all others,
+            // which hold at most half of the strings each, so the recursion depth stays logarithmic
+            usize largest = 0;
+            for(usize bucket = 1; bucket <= radix_bucket_count; ++bucket) {
+                if(offsets[bucket + 1] - offsets[bucket] > offsets[largest + 1] - offsets[largest]) {
+                    largest = bucket;
+                }
+            }
+            for(usize bucket = 1; bucket <= radix_bucket_count; ++bucket) {
+                const auto size = offsets[bucket + 1] - offsets[bucket];
+                if(bucket != largest && size > 1) {
+                    sorting::msd_sort(values + offsets[bucket], scratch + offsets[bucket], size, depth);
+                }
+            }
+            if(largest == 0) {
+                return;// All strings in the largest bucket are equal
+            }
+            values += offsets[largest];
+            scratch += offsets[largest];
+            count = offsets[largest + 1] - offsets[largest];
+        }
+        // All strings share their first depth bytes, so only the rest needs to be compared
+        std::less<std::string_view> less {};
+        std::sort(values, values + count, [depth, &less](std::string_view lhs, std::string_view rhs) {
+            return less(lhs.substr(depth), rhs.substr(depth));
+        });
+    }
+
+    inline auto parallel_msd_sort(std::string_view* values, std::string_view* scratch, usize count,
+                                  usize thread_count) -> void {
+        const auto offsets = distribute_strings(values, scratch, count, 0);
+        std::atomic<usize> next_bucket {1};
+        std::vector<std::thread> threads {};
+        threads.reserve(thread_count);
+        for(usize thread = 0; thread < thread_count; ++thread) {
+            threads.emplace_back([&] {
+                usize bucket;
+                while((bucket = next_bucket.fetch_add(1, std::memory_order_relaxed)) <= radix_bucket_count) {
+                    const auto size = offsets[bucket + 1] - offsets[bucket];
+                    if(size > 1) {
+                        msd_sort(values + offsets[bucket], scratch + offsets[bucket], size, 1);
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads) {
+            thread.join();
+        }
+    }
+}// namespace kstd::sorting
+
+namespace kstd {
+    /**
+     * Stable LSD radix sort by the given key of every element, one byte per pass.
+     * Passes in which all keys share the same byte are skipped.
+     *
+     * @tparam T The type of the elements to sort.
+     * @tparam F The type of the key function, which has to return a type supported by kstd::RadixKey.
+     * @param values The elements to sort.
+     * @param scratch A buffer with room for at least as many elements as there are values,
+     *                for example allocated from an arena. Its contents are unspecified afterwards.
+     * @param function The function extracting the key of an element.
+     * @param thread_count The number of threads to sort with.
+     * @return An error if the scratch buffer is too small.
+     */
+    template<typename T, typename F>
+    [[nodiscard]] inline auto radix_sort_by_key(Slice<T> values, Slice<T> scratch, F&& function,
+                                                usize thread_count = 1) -> Result<void> {
+        using KeyType = std::decay_t<std::invoke_result_t<F&, const T&>>;
+        const auto count = values.get_count();
+        if(scratch.get_count() < count) {
+            return Error {fmt::format("Scratch buffer holds {} elements but {} are required", scratch.get_count(),
+                                      count)};
+        }
+        auto key = [&function](const T& value) {
+            return RadixKey<KeyType>::to_bits(function(value));
+        };
+        if(thread_count > 1 && count >= thread_count * sorting::radix_bucket_count) {
+            sorting::parallel_lsd_sort(values.get_data(), scratch.get_data(), count, key, thread_count);
+        }
+        else {
+            sorting::lsd_sort(values.get_data(), scratch.get_data(), count, key);
+        }
+        return {};
+    }
+
+    /**
+     * Stable LSD radix sort of integer or floating point values in ascending order.
+     * Floats are ordered by their IEEE-754 total order.
+     *
+     * @param values The elements to sort.
+     * @param scratch A buffer with room for at least as many elements as there are values.
+     * @param thread_count The number of threads to sort with.
+     * @return An error if the scratch buffer is too small.
+     */
+    template<typename T>
+    [[nodiscard]] inline auto radix_sort(Slice<T> values, Slice<T> scratch, usize thread_count = 1) -> Result<void> {
+        return radix_sort_by_key(values, scratch, [](const T& value) {
+            return value;
+        }, thread_count);
+    }
+
+    /**
+     * Like kstd::radix_sort, but allocates its own scratch buffer.
+     */
+    template<typename T>
+    inline auto radix_sort(Slice<T> values) -> void {
+        std::vector<T> scratch(values.get_count());
+        static_cast<void>(radix_sort(values, Slice<T> {scratch.data(), scratch.size() * sizeof(T)}));
+    }
+
+    /**
+     * MSD radix sort of strings in lexicographical byte order, which only looks at
+     * as many bytes of every string as are needed to tell it apart from the others.
+     * With more than one thread, the buckets of the first byte are sorted concurrently.
+     *
+     * @param values The strings to sort.
+     * @param scratch A buffer with room for at least as many strings as there are values.
+     * @param thread_count The number of threads to sort with.
+     * @return An error if the scratch buffer is too small.
+     */
+    [[nodiscard]] inline auto radix_sort(Slice<std::string_view> values, Slice<std::string_view> scratch,
+                                         usize thread_count = 1) -> Result<void> {
+        const auto count = values.get_count();
+        if(scratch.get_count() < count) {
+            return Error {fmt::format("Scratch buffer holds {} elements but {} are required", scratch.get_count(),
+                                      count)};
+        }
+        if(count < 2) {
+            return {};
+        }
+        if(thread_count > 1 && count >= sorting::string_insertion_threshold) {
+            sorting::parallel_msd_sort(values.get_data(), scratch.get_data(), count, thread_count);
+        }
+        else {
+            sorting::msd_sort(values.get_data(), scratch.get_data(), count, 0);
+        }
+        return {};
+    }
+
+    inline auto radix_sort(Slice<std::string_view> values) -> void {
+        std::vector<std::string_view> scratch(values.get_count());
+        static_cast<void>(
+                radix_sort(values, Slice<std::string_view> {scratch.data(), scratch.size() * sizeof(std::string_view)}));
+    }
+}// namespace kstd
@@ -0,0 +1,160 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+#include "defaults.hpp"
+#include "epoch.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    /**
+     * A read-copy-update cell holding an immutable snapshot of a value.
+     * Readers pin the epoch domain and dereference the current version without
+     * touching any shared reference count, writers publish a new version with
+     * a single atomic pointer swap. Replaced versions are handed to the
+     * epoch domain and destroyed once every reader which might still observe
+     * them has unpinned.
+     *
+     * @tparam T The type of the stored value.
+     */
+    template<typename T>
+    class RcuCell final {
+        static_assert(!std::is_reference_v<T>, "Type cannot be a reference");
+
+        public:
+        using ValueType = T;
+        using Self = RcuCell<ValueType>;
+
+        /**
+         * RAII object which keeps the version it was created from alive.
+         */
+        class ReadGuard final {
+            Epoch::Guard _guard;
+            const ValueType* _value;
+
+            friend class RcuCell;
+
+            ReadGuard(Epoch::Guard guard, const ValueType* value) noexcept :
+                    _guard {std::move(guard)},
+                    _value {value} {
+            }
+
+            public:
+            KSTD_NO_COPY(ReadGuard, ReadGuard, constexpr)
+            KSTD_DEFAULT_MOVE(ReadGuard, ReadGuard, inline)
+
+            ~ReadGuard() noexcept = default;
+
+            [[nodiscard]] inline auto get() const noexcept -> const ValueType& {
+                return *_value;
+            }
+
+            [[nodiscard]] inline auto operator*() const noexcept -> const ValueType& {
+                return *_value;
+            }
+
+            [[nodiscard]] inline auto operator->() const noexcept -> const ValueType* {
+                return _value;
+            }
+        };
+
+        private:
+        Epoch _epoch;
+        std::atomic<ValueType*> _current;
+
+        public:
+        KSTD_NO_MOVE_COPY(RcuCell, Self, constexpr)
+
+        /**
+         * @param value The initial version of the value.
+         * @param epoch The reclamation domain used for retiring replaced versions.
+         */
+        explicit RcuCell(ValueType value, Epoch epoch = Epoch::get_global()) :
+                _epoch {std::move(epoch)},
+                _current {new ValueType(std::move(value))} {
+        }
+
+        /**
+         * Destroys the current version. No reader may be active anymore.
+         */
+        ~RcuCell() noexcept {
+            delete _current.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @return A guard through which the current version can be accessed.
+         */
+        [[nodiscard]] inline auto read() const noexcept -> ReadGuard {
+            auto guard = _epoch.pin();
+            return {std::move(guard), _current.load(std::memory_order_acquire)};
+        }
+
+        /**
+         * @return A copy of the current version.
+         */
+        [[nodiscard]] inline auto load() const -> ValueType {
+            return *read();
+        }
+
+        /**
+         * Replaces the current version, retiring the previous one.
+         *
+         * @param value The new version to publish.
+         */
+        inline auto publish(ValueType value) -> void {
+            auto* previous = _current.exchange(new ValueType(std::move(value)), std::memory_order_acq_rel);
+            _epoch.retire(previous);
+        }
+
+        /**
+         * Derives a new version from the current one and publishes it.
+         * The function may be invoked multiple times if other writers
+         * publish concurrently, so it should not have side effects.
+         *
+         * @tparam F The type of the function to invoke.
+         * @param function A function which receives the current version and returns the next one.
+         */
+        template<typename F>
+        inline auto update(F&& function) -> void {
+            static_assert(std::is_invocable_r_v<ValueType, F, const ValueType&>,
+                          "Function must map the current value to a new value");
+            auto guard = _epoch.pin();
+            auto* current = _current.load(std::memory_order_acquire);
+            while(true) {
+                auto* next = new ValueType(function(static_cast<const ValueType&>(*current)));
+                if(_current.compare_exchange_weak(current, next, std::memory_order_acq_rel,
+                                                  std::memory_order_acquire)) {
+                    break;
+                }
+                delete next;
+            }
+            guard.release();
+            _epoch.retire(current);
+        }
+
+        [[nodiscard]] inline auto get_epoch() const noexcept -> const Epoch& {
+            return _epoch;
+        }
+    };
+}// namespace kstd
@@ -0,0 +1,222 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "defaults.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    /**
+     * A type-erased pointer which has been retired from a concurrent data structure,
+     * together with the deleter that has to be invoked once it is safe to reclaim it.
+     * Deleters which are empty (like std::default_delete or libc::FreeDeleter) or
+     * small and trivially copyable (like a pointer to a pool allocator) are stored
+     * inline; anything else is moved to the heap.
+     */
+    class Retired final {
+        using Function = void (*)(void*, void*) noexcept;
+
+        void* _pointer;
+        Function _function;
+        void* _context;
+
+        constexpr Retired(void* pointer, Function function, void* context) noexcept :
+                _pointer {pointer},
+                _function {function},
+                _context {context} {
+        }
+
+        template<typename D>
+        static constexpr bool is_inline =
+                std::is_empty_v<D> || (sizeof(D) <= sizeof(void*) && std::is_trivially_copyable_v<D>);
+
+        public:
+        KSTD_NO_COPY(Retired, Retired, constexpr)
+
+        constexpr Retired(Retired&& other) noexcept :
+                _pointer {std::exchange(other._pointer, nullptr)},
+                _function {std::exchange(other._function, nullptr)},
+                _context {std::exchange(other._context, nullptr)} {
+        }
+
+        ~Retired() noexcept = default;
+
+        constexpr auto operator=(Retired&& other) noexcept -> Retired& {
+            if(this != &other) {
+                _pointer = std::exchange(other._pointer, nullptr);
+                _function = std::exchange(other._function, nullptr);
+                _context = std::exchange(other._context, nullptr);
+            }
+            return *this;
+        }
+
+        template<typename T, typename D = std::default_delete<T>>
+        [[nodiscard]] static inline auto make(T* pointer, D deleter = D {}) noexcept -> Retired {
+            if constexpr(std::is_empty_v<D>) {
+                return {const_cast<std::remove_cv_t<T>*>(pointer),
+                        [](void* address, void*) noexcept {
+                            D {}(static_cast<T*>(address));
+                        },
+                        nullptr};
+            }
+            else if constexpr(is_inline<D>) {
+                void* context = nullptr;
+                std::memcpy(&context, &deleter, sizeof(D));
+                return {const_cast<std::remove_cv_t<T>*>(pointer),
+                        [](void* address, void* context) noexcept {
+                            alignas(D) u8 storage[sizeof(D)];// NOLINT
+                            std::memcpy(storage, &context, sizeof(D));
+                            (*std::launder(reinterpret_cast<D*>(storage)))(static_cast<T*>(address));
+                        },
+                        context};
+            }
+            else {
+                return {const_cast<std::remove_cv_t<T>*>(pointer),
+                        [](void* address, void* context) noexcept {
+                            auto* heap_deleter = static_cast<D*>(context);
+                            (*heap_deleter)(static_cast<T*>(address));
+                            delete heap_deleter;// NOLINT
+                        },
+                        new D(std::move(deleter))};
+            }
+        }
+
+        [[nodiscard]] constexpr auto get_pointer() const noexcept -> const void* {
+            return _pointer;
+        }
+
+        /**
+         * Invokes the deleter on the retired pointer, subsequent calls
+         * and calls on a moved-from instance do nothing.
+         */
+        inline auto reclaim() noexcept -> void {
+            if(_function == nullptr) {
+                return;
+            }
+            std::exchange(_function, nullptr)(_pointer, _context);
+        }
+    };
+}// namespace kstd
+
+namespace kstd::reclamation {
+    /**
+     * Claims an unused node from a lock-free list of recyclable nodes,
+     * or pushes a new node if all of them are currently in use.
+     * Nodes are only ever freed by destroy, so the list can be walked without protection.
+     *
+     * @tparam T The node type, which needs an atomic in_use flag defaulting to true and a next pointer.
+     * @param head The head of the list.
+     * @return A node which is owned by the caller until in_use is cleared.
+     */
+    template<typename T>
+    [[nodiscard]] inline auto acquire(std::atomic<T*>& head) noexcept -> T* {
+        for(auto* node = head.load(std::memory_order_acquire); node != nullptr; node = node->next) {
+            auto expected = false;
+            if(!node->in_use.load(std::memory_order_relaxed) &&
+               node->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return node;
+            }
+        }
+        auto* node = new T();// NOLINT
+        node->next = head.load(std::memory_order_relaxed);
+        while(!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        return node;
+    }
+
+    /**
+     * Frees all nodes of a list filled by acquire, no other thread may access the list anymore.
+     */
+    template<typename T>
+    inline auto destroy(std::atomic<T*>& head) noexcept -> void {
+        auto* node = head.load(std::memory_order_acquire);
+        while(node != nullptr) {
+            delete std::exchange(node, node->next);// NOLINT
+        }
+    }
+
+    /**
+     * Maps the reclamation domains used by the calling thread onto the record it owns in each of them.
+     * Records are handed back to their domain after collecting once the thread exits,
+     * or once the domain has been dropped by everyone but the calling thread.
+     *
+     * @tparam S The shared state of the domain, which needs a collect(R&) function.
+     * @tparam R The per-thread record type of the domain, as used with acquire.
+     */
+    template<typename S, typename R>
+    class ThreadCache final {
+        std::vector<std::pair<std::shared_ptr<S>, R*>> _entries {};
+
+        static inline auto release(S& state, R& record) noexcept -> void {
+            state.collect(record);
+            record.in_use.store(false, std::memory_order_release);
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(ThreadCache, ThreadCache, inline)
+
+        ThreadCache() noexcept = default;
+
+        ~ThreadCache() noexcept {
+            for(auto& [state, record] : _entries) {
+                release(*state, *record);
+            }
+        }
+
+        [[nodiscard]] inline auto get_record(const std::shared_ptr<S>& state, std::atomic<R*>& head) noexcept -> R& {
+            for(auto& [entry_state, record] : _entries) {
+                if(entry_state == state) {
+                    return *record;
+                }
+            }
+            // Drop domains which were destroyed by everyone but this thread
+            _entries.erase(std::remove_if(_entries.begin(), _entries.end(),
+                                          [](auto& entry) {
+                                              if(entry.first.use_count() != 1) {
+                                                  return false;
+                                              }
+                                              release(*entry.first, *entry.second);
+                                              return true;
+                                          }),
+                           _entries.end());
+            auto* record = acquire(head);
+            _entries.emplace_back(state, record);
+            return *record;
+        }
+    };
+
+    /**
+     * @return The record the calling thread owns in the domain with the given state.
+     */
+    template<typename S, typename R>
+    [[nodiscard]] inline auto get_record(const std::shared_ptr<S>& state, std::atomic<R*>& head) noexcept -> R& {
+        thread_local ThreadCache<S, R> cache {};
+        return cache.get_record(state, head);
+    }
+}// namespace kstd::reclamation
\ No newline at end of file
@@ -145,7 +145,19 @@ namespace kstd {
         }
 
         template<typename NEW_T>
-        [[nodiscard]] constexpr auto forward() const noexcept -> Result<NEW_T, ErrorType> {
+        [[nodiscard]] constexpr auto forward() const& noexcept -> Result<NEW_T, ErrorType> {
+            if(is_empty()) {
+                return {};
+            }
+            assert_true(is_error());
+            return {std::get<WrappedErrorType>(_value)};
+        }
+
+        /**
+         * Moves the error out of this result instead of copying it.
+         */
+        template<typename NEW_T>
+        [[nodiscard]] constexpr auto forward() && noexcept -> Result<NEW_T, ErrorType> {
             if(is_empty()) {
                 return {};
             }
@@ -153,7 +165,7 @@ namespace kstd {
             return {std::move(std::get<WrappedErrorType>(_value))};
         }
 
-        template<typename NEW_T, typename = std::enable_if_t<std::is_same_v<ErrorType, std::string>>>
+        template<typename NEW_T, typename EE = ErrorType, typename = std::enable_if_t<std::is_same_v<EE, std::string>>>
         [[nodiscard]] constexpr auto
         forward_with_trace(const SourceLocation location = SourceLocation::current()) const noexcept
                 -> Result<NEW_T, std::string> {
@@ -299,7 +311,19 @@ namespace kstd {
         }
 
         template<typename TT>
-        [[nodiscard]] constexpr auto forward() const noexcept -> Result<TT, E> {
+        [[nodiscard]] constexpr auto forward() const& noexcept -> Result<TT, E> {
+            if(is_empty()) {
+                return {};
+            }
+            assert_true(is_error());
+            return {std::get<WrappedErrorType>(_value)};
+        }
+
+        /**
+         * Moves the error out of this result instead of copying it.
+         */
+        template<typename TT>
+        [[nodiscard]] constexpr auto forward() && noexcept -> Result<TT, E> {
             if(is_empty()) {
                 return {};
             }
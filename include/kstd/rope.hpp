@@ -0,0 +1,417 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "assert.hpp"
+#include "defaults.hpp"
+#include "slice.hpp"
+#include "types.hpp"
+#include "unicode.hpp"
+
+namespace kstd {
+    /**
+     * A string built from a balanced (AVL) tree of immutable chunks.
+     * Concatenation, insertion, erasure and slicing run in O(log n) and share
+     * the existing chunks instead of copying characters; strings which are
+     * moved into a rope become a chunk as-is. Since nodes are immutable and
+     * reference counted, copying a rope is O(1) and copies may be handed to
+     * other threads. Indices are in code units, the code point based functions
+     * use kstd::unicode::UTFTraits to interpret the encoding of CHAR.
+     *
+     * @tparam CHAR The code unit type of the rope.
+     */
+    template<typename CHAR>
+    class Rope final {
+        public:
+        using CharType = CHAR;
+        using Self = Rope<CharType>;
+        using String = std::basic_string<CharType>;
+        using StringView = std::basic_string_view<CharType>;
+        using Traits = unicode::UTFTraits<CharType>;
+
+        /**
+         * Adjacent chunks which are shorter than this combined are merged
+         * when joined, so appending small pieces doesn't degrade into one node per piece.
+         */
+        static constexpr usize merge_threshold = 256;
+
+        private:
+        struct Node;
+        using NodePtr = std::shared_ptr<const Node>;
+
+        struct Node final {
+            NodePtr left;
+            NodePtr right;
+            std::shared_ptr<const String> buffer;
+            usize offset;
+            usize length;
+            usize code_points;
+            u32 height;
+
+            [[nodiscard]] inline auto is_leaf() const noexcept -> bool {
+                return buffer != nullptr;
+            }
+
+            [[nodiscard]] inline auto get_text() const noexcept -> StringView {
+                return {buffer->data() + offset, length};
+            }
+        };
+
+        NodePtr _root;
+
+        explicit Rope(NodePtr root) noexcept :
+                _root {std::move(root)} {
+        }
+
+        [[nodiscard]] static inline auto get_height(const NodePtr& node) noexcept -> u32 {
+            return node == nullptr ? 0 : node->height;
+        }
+
+        [[nodiscard]] static inline auto count_code_points(StringView text) noexcept -> usize {
+            usize count = 0;
+            for(const auto value : text) {
+                if(Traits::is_lead(value)) {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        [[nodiscard]] static inline auto make_leaf(std::shared_ptr<const String> buffer, usize offset, usize length)
+                -> NodePtr {
+            if(length == 0) {
+                return nullptr;
+            }
+            const auto code_points = count_code_points({buffer->data() + offset, length});
+            return std::make_shared<const Node>(Node {nullptr, nullptr, std::move(buffer), offset, length, code_points, 0});
+        }
+
+        [[nodiscard]] static inline auto make_node(NodePtr left, NodePtr right) -> NodePtr {
+            const auto length = left->length + right->length;
+            const auto code_points = left->code_points + right->code_points;
+            const auto height = std::max(left->height, right->height) + 1;
+            return std::make_shared<const Node>(
+                    Node {std::move(left), std::move(right), nullptr, 0, length, code_points, height});
+        }
+
+        /**
+         * Creates a node from two subtrees whose heights differ by at most two,
+         * applying a single or double rotation if required.
+         */
+        [[nodiscard]] static inline auto balance(NodePtr left, NodePtr right) -> NodePtr {
+            const auto left_height = get_height(left);
+            const auto right_height = get_height(right);
+            if(left_height > right_height + 1) {
+                if(get_height(left->left) >= get_height(left->right)) {
+                    return make_node(left->left, make_node(left->right, std::move(right)));
+                }
+                const auto& pivot = left->right;
+                return make_node(make_node(left->left, pivot->left), make_node(pivot->right, std::move(right)));
+            }
+            if(right_height > left_height + 1) {
+                if(get_height(right->right) >= get_height(right->left)) {
+                    return make_node(make_node(std::move(left), right->left), right->right);
+                }
+                const auto& pivot = right->left;
+                return make_node(make_node(std::move(left), pivot->left), make_node(pivot->right, right->right));
+            }
+            return make_node(std::move(left), std::move(right));
+        }
+
+        [[nodiscard]] static inline auto join(NodePtr left, NodePtr right) -> NodePtr {
+            if(left == nullptr) {
+                return right;
+            }
+            if(right == nullptr) {
+                return left;
+            }
+            if(left->is_leaf() && right->is_leaf() && left->length + right->length <= merge_threshold) {
+                String text {};
+                text.reserve(left->length + right->length);
+                text.append(left->get_text());
+                text.append(right->get_text());
+                const auto length = text.size();
+                return make_leaf(std::make_shared<const String>(std::move(text)), 0, length);
+            }
+            const auto left_height = left->height;
+            const auto right_height = right->height;
+            if(left_height > right_height + 1) {
+                return balance(left->left, join(left->right, std::move(right)));
+            }
+            if(right_height > left_height + 1) {
+                return balance(join(std::move(left), right->left), right->right);
+            }
+            return make_node(std::move(left), std::move(right));
+        }
+
+        [[nodiscard]] static inline auto split(const NodePtr& node, usize index) -> std::pair<NodePtr, NodePtr> {
+            if(node == nullptr || index == 0) {
+                return {nullptr, node};
+            }
+            if(index >= node->length) {
+                return {node, nullptr};
+            }
+            if(node->is_leaf()) {
+                return {make_leaf(node->buffer, node->offset, index),
+                        make_leaf(node->buffer, node->offset + index, node->length - index)};
+            }
+            const auto left_length = node->left->length;
+            if(index < left_length) {
+                auto [first, second] = split(node->left, index);
+                return {std::move(first), join(std::move(second), node->right)};
+            }
+            if(index == left_length) {
+                return {node->left, node->right};
+            }
+            auto [first, second] = split(node->right, index - left_length);
+            return {join(node->left, std::move(first)), std::move(second)};
+        }
+
+        template<typename F>
+        static inline auto for_each_leaf(const NodePtr& node, F& function) -> void {
+            if(node == nullptr) {
+                return;
+            }
+            if(node->is_leaf()) {
+                function(node->get_text());
+                return;
+            }
+            for_each_leaf(node->left, function);
+            for_each_leaf(node->right, function);
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(Rope, Self, inline)
+
+        Rope() noexcept :
+                _root {} {
+        }
+
+        /**
+         * Creates a rope which takes ownership of the given string without copying it.
+         */
+        Rope(String&& value) :// NOLINT
+                _root {} {
+            const auto length = value.size();
+            _root = make_leaf(std::make_shared<const String>(std::move(value)), 0, length);
+        }
+
+        Rope(const String& value) :// NOLINT
+                Rope(String {value}) {
+        }
+
+        Rope(StringView value) :// NOLINT
+                Rope(String {value}) {
+        }
+
+        Rope(const CharType* value) :// NOLINT
+                Rope(String {value}) {
+        }
+
+        ~Rope() noexcept = default;
+
+        /**
+         * @return The number of code units in the rope.
+         */
+        [[nodiscard]] inline auto get_length() const noexcept -> usize {
+            return _root == nullptr ? 0 : _root->length;
+        }
+
+        [[nodiscard]] inline auto get_code_point_count() const noexcept -> usize {
+            return _root == nullptr ? 0 : _root->code_points;
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return _root == nullptr;
+        }
+
+        /**
+         * @return The height of the underlying tree, which is logarithmic in the number of chunks.
+         */
+        [[nodiscard]] inline auto get_depth() const noexcept -> usize {
+            return _root == nullptr ? 0 : _root->height + 1;
+        }
+
+        [[nodiscard]] inline auto at(usize index) const noexcept -> CharType {
+            assert_true(index < get_length());
+            const auto* node = _root.get();
+            while(!node->is_leaf()) {
+                const auto left_length = node->left->length;
+                if(index < left_length) {
+                    node = node->left.get();
+                    continue;
+                }
+                index -= left_length;
+                node = node->right.get();
+            }
+            return node->get_text()[index];
+        }
+
+        [[nodiscard]] inline auto operator[](usize index) const noexcept -> CharType {
+            return at(index);
+        }
+
+        /**
+         * @param code_point The index of a code point, or the number of code points for the end.
+         * @return The index of the first code unit of the given code point.
+         */
+        [[nodiscard]] inline auto get_index_of_code_point(usize code_point) const noexcept -> usize {
+            assert_true(code_point <= get_code_point_count());
+            if(code_point == get_code_point_count()) {
+                return get_length();
+            }
+            const auto* node = _root.get();
+            usize index = 0;
+            while(!node->is_leaf()) {
+                const auto left_code_points = node->left->code_points;
+                if(code_point < left_code_points) {
+                    node = node->left.get();
+                    continue;
+                }
+                code_point -= left_code_points;
+                index += node->left->length;
+                node = node->right.get();
+            }
+            const auto text = node->get_text();
+            for(usize offset = 0; offset < text.size(); ++offset) {
+                if(!Traits::is_lead(text[offset])) {
+                    continue;
+                }
+                if(code_point == 0) {
+                    return index + offset;
+                }
+                --code_point;
+            }
+            return index + text.size();
+        }
+
+        inline auto append(Rope other) -> void {
+            _root = join(std::move(_root), std::move(other._root));
+        }
+
+        inline auto prepend(Rope other) -> void {
+            _root = join(std::move(other._root), std::move(_root));
+        }
+
+        /**
+         * Inserts the given rope before the code unit at the given index.
+         */
+        inline auto insert(usize index, Rope other) -> void {
+            assert_true(index <= get_length());
+            auto [first, second] = split(_root, index);
+            _root = join(join(std::move(first), std::move(other._root)), std::move(second));
+        }
+
+        /**
+         * Removes the given range of code units.
+         */
+        inline auto erase(usize index, usize count) -> void {
+            assert_true(index <= get_length());
+            auto [first, rest] = split(_root, index);
+            auto [removed, second] = split(rest, count);
+            _root = join(std::move(first), std::move(second));
+        }
+
+        /**
+         * @return A rope sharing the chunks of the given range of code units.
+         */
+        [[nodiscard]] inline auto substr(usize index, usize count) const -> Rope {
+            assert_true(index <= get_length());
+            auto [first, rest] = split(_root, index);
+            return Rope {split(rest, count).first};
+        }
+
+        /**
+         * @return Two ropes containing the code units before and starting at the given index.
+         */
+        [[nodiscard]] inline auto split_at(usize index) const -> std::pair<Rope, Rope> {
+            auto [first, second] = split(_root, index);
+            return {Rope {std::move(first)}, Rope {std::move(second)}};
+        }
+
+        inline auto clear() noexcept -> void {
+            _root = nullptr;
+        }
+
+        /**
+         * Invokes the given function with every chunk of the rope in order.
+         */
+        template<typename F>
+        inline auto for_each_chunk(F&& function) const -> void {
+            for_each_leaf(_root, function);
+        }
+
+        /**
+         * @return A gather list of all chunks in order, e.g. for building the iovec array of writev.
+         *         The slices stay valid as long as any rope shares the chunks.
+         */
+        [[nodiscard]] inline auto get_chunks() const -> std::vector<Slice<const CharType>> {
+            std::vector<Slice<const CharType>> chunks {};
+            for_each_chunk([&chunks](StringView chunk) {
+                chunks.emplace_back(chunk.data(), chunk.size() * sizeof(CharType));
+            });
+            return chunks;
+        }
+
+        [[nodiscard]] inline auto to_string() const -> String {
+            String result {};
+            result.reserve(get_length());
+            for_each_chunk([&result](StringView chunk) {
+                result.append(chunk);
+            });
+            return result;
+        }
+
+        [[nodiscard]] inline auto operator==(StringView other) const noexcept -> bool {
+            if(other.size() != get_length()) {
+                return false;
+            }
+            usize offset = 0;
+            bool equal = true;
+            for_each_chunk([&](StringView chunk) {
+                if(equal) {
+                    equal = other.substr(offset, chunk.size()) == chunk;
+                    offset += chunk.size();
+                }
+            });
+            return equal;
+        }
+
+        [[nodiscard]] inline auto operator!=(StringView other) const noexcept -> bool {
+            return !(*this == other);
+        }
+
+        [[nodiscard]] inline auto operator+(Rope other) const -> Rope {
+            return Rope {join(_root, std::move(other._root))};
+        }
+
+        inline auto operator+=(Rope other) -> Self& {
+            append(std::move(other));
+            return *this;
+        }
+    };
+}// namespace kstd
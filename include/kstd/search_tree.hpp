@@ -0,0 +1,409 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "assert.hpp"
+#include "bits.hpp"
+#include "defaults.hpp"
+#include "slice.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif// __AVX2__
+
+namespace kstd::search {
+    constexpr usize cache_line_size = 64;
+    constexpr usize batch_size = 8;
+
+    /**
+     * Allocator which aligns every allocation to a cache line,
+     * so that nodes which fill a cache line are never split across two.
+     */
+    template<typename T>
+    struct CacheAlignedAllocator {
+        using value_type = T;
+
+        static constexpr usize alignment = std::max(cache_line_size, alignof(T));
+
+        constexpr CacheAlignedAllocator() noexcept = default;
+
+        template<typename U>
+        constexpr CacheAlignedAllocator(const CacheAlignedAllocator<U>&) noexcept {// NOLINT
+        }
+
+        [[nodiscard]] inline auto allocate(usize count) -> T* {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t {alignment}));
+        }
+
+        inline auto deallocate(T* pointer, [[maybe_unused]] usize count) noexcept -> void {
+            ::operator delete(pointer, std::align_val_t {alignment});
+        }
+
+        template<typename U>
+        [[nodiscard]] constexpr auto operator==(const CacheAlignedAllocator<U>&) const noexcept -> bool {
+            return true;
+        }
+
+        template<typename U>
+        [[nodiscard]] constexpr auto operator!=(const CacheAlignedAllocator<U>&) const noexcept -> bool {
+            return false;
+        }
+    };
+
+    /**
+     * Prefetches the element at the given index without forming a pointer past the end of the array.
+     */
+    template<typename T>
+    inline auto prefetch_at(const T* data, usize index) noexcept -> void {
+        utils::prefetch(reinterpret_cast<const void*>(reinterpret_cast<std::uintptr_t>(data) + index * sizeof(T)));
+    }
+
+    /**
+     * @return The number of the given keys which are less than the given value.
+     */
+    template<typename T, usize COUNT>
+    [[nodiscard]] inline auto count_less(const T* keys, const T& value) noexcept -> usize {
+#ifdef __AVX2__
+        if constexpr(sizeof(T) == sizeof(i32) && std::is_arithmetic_v<T> && COUNT % 8 == 0) {
+            usize count = 0;
+            for(usize index = 0; index < COUNT; index += 8) {
+                const auto* address = keys + index;
+                u32 mask;
+                if constexpr(std::is_floating_point_v<T>) {
+                    const auto less = _mm256_cmp_ps(_mm256_loadu_ps(address), _mm256_set1_ps(value), _CMP_LT_OQ);
+                    mask = static_cast<u32>(_mm256_movemask_ps(less));
+                }
+                else {
+                    auto lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(address));
+                    auto rhs = _mm256_set1_epi32(static_cast<i32>(value));
+                    if constexpr(std::is_unsigned_v<T>) {
+                        const auto sign = _mm256_set1_epi32(std::numeric_limits<i32>::min());
+                        lhs = _mm256_xor_si256(lhs, sign);
+                        rhs = _mm256_xor_si256(rhs, sign);
+                    }
+                    mask = static_cast<u32>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(rhs, lhs))));
+                }
+                count += bits::popcount(mask);
+            }
+            return count;
+        }
+#endif// __AVX2__
+        usize count = 0;
+        for(usize index = 0; index < COUNT; ++index) {
+            count += static_cast<usize>(keys[index] < value);
+        }
+        return count;
+    }
+}// namespace kstd::search
+
+namespace kstd {
+    /**
+     * A read-only copy of a sorted sequence in Eytzinger (BFS) order, where the
+     * children of the node at index k are at 2k and 2k + 1. The first levels of the
+     * tree share a handful of cache lines and the descent is branchless. The keys are
+     * stored cache line aligned, so all descendants of a node which are as many levels
+     * down as fit into a cache line (the 16 great-great-grandchildren for 32-bit keys)
+     * are prefetched with a single cache line.
+     *
+     * @tparam T The type of the keys, which needs to be default constructible and less-than comparable.
+     */
+    template<typename T>
+    class EytzingerIndex final {
+        static constexpr usize prefetch_stride = std::max<usize>(1, search::cache_line_size / sizeof(T));
+
+        std::vector<T, search::CacheAlignedAllocator<T>> _keys;// One-based, the first element is unused
+        std::vector<usize> _ranks;
+        usize _size;
+        usize _height;
+
+        auto build(const T* sorted, usize& index, usize node) -> void {
+            if(node > _size) {
+                return;
+            }
+            build(sorted, index, node * 2);
+            _keys[node] = sorted[index];
+            _ranks[node] = index++;
+            build(sorted, index, node * 2 + 1);
+        }
+
+        /**
+         * @return The node holding the lower bound, or zero if every key is less than the searched one.
+         */
+        [[nodiscard]] static inline auto resolve(usize node) noexcept -> usize {
+            // Undo all right turns after the last left turn, which was taken at the result
+            return node >> (bits::count_trailing_zeros(~node) + 1);
+        }
+
+        [[nodiscard]] inline auto get_rank(usize node) const noexcept -> usize {
+            return node == 0 ? _size : _ranks[node];
+        }
+
+        [[nodiscard]] inline auto find_node(const T& key) const noexcept -> usize {
+            const auto* keys = _keys.data();
+            usize node = 1;
+            while(node <= _size) {
+                search::prefetch_at(keys, node * prefetch_stride);
+                node = node * 2 + static_cast<usize>(keys[node] < key);
+            }
+            return resolve(node);
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(EytzingerIndex, EytzingerIndex, inline)
+
+        EytzingerIndex() noexcept :
+                _keys {},
+                _ranks {},
+                _size {0},
+                _height {0} {
+        }
+
+        /**
+         * @param sorted The keys to index, which must be sorted in ascending order.
+         */
+        explicit EytzingerIndex(Slice<const T> sorted) :
+                _keys(sorted.get_count() + 1),
+                _ranks(sorted.get_count() + 1),
+                _size {sorted.get_count()},
+                _height {_size == 0 ? 0 : 64 - bits::count_leading_zeros(static_cast<u64>(_size))} {
+            usize index = 0;
+            build(sorted.get_data(), index, 1);
+        }
+
+        ~EytzingerIndex() noexcept = default;
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _size;
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return _size == 0;
+        }
+
+        /**
+         * @return The index of the first key in the original sorted sequence which is
+         *         not less than the given key, or the size of this index if there is none.
+         */
+        [[nodiscard]] inline auto lower_bound(const T& key) const noexcept -> usize {
+            return get_rank(find_node(key));
+        }
+
+        [[nodiscard]] inline auto contains(const T& key) const noexcept -> bool {
+            const auto node = find_node(key);
+            return node != 0 && !(key < _keys[node]);
+        }
+
+        /**
+         * Looks up multiple keys at once, interleaving the descents of
+         * several keys so that their cache misses overlap.
+         *
+         * @param keys The keys to look up.
+         * @param results The lower bound of every key, as returned by lower_bound.
+         */
+        inline auto lower_bound_many(Slice<const T> keys, Slice<usize> results) const noexcept -> void {
+            const auto count = keys.get_count();
+            assert_true(results.get_count() >= count);
+            const auto* data = _keys.data();
+            const auto* key_data = keys.get_data();
+            auto* result_data = results.get_data();
+            for(usize base = 0; base < count; base += search::batch_size) {
+                const auto batch_count = std::min(search::batch_size, count - base);
+                std::array<usize, search::batch_size> nodes {};
+                nodes.fill(1);
+                for(usize level = 0; level < _height; ++level) {
+                    for(usize index = 0; index < batch_count; ++index) {
+                        auto& node = nodes[index];
+                        if(node <= _size) {
+                            node = node * 2 + static_cast<usize>(data[node] < key_data[base + index]);
+                            search::prefetch_at(data, node * prefetch_stride);
+                        }
+                    }
+                }
+                for(usize index = 0; index < batch_count; ++index) {
+                    result_data[base + index] = get_rank(resolve(nodes[index]));
+                }
+            }
+        }
+    };
+
+    /**
+     * A read-only B+-tree over a sorted sequence of arithmetic keys, with every node
+     * filling a single cache line by default. The leaves hold the keys in their
+     * original order, the inner layers above only hold copies of the first key of
+     * their right subtrees. All nodes live in a single cache line aligned array without any child pointers,
+     * and every node is searched by counting the keys less than the given value,
+     * which is done with SIMD compares where available.
+     *
+     * @tparam T The type of the keys.
+     * @tparam B The number of keys per node.
+     */
+    template<typename T, usize B = search::cache_line_size / sizeof(T)>
+    class StaticSearchTree final {
+        static_assert(std::is_arithmetic_v<T>, "Key type must be arithmetic");
+        static_assert(B > 0, "Nodes must hold at least one key");
+
+        std::vector<T, search::CacheAlignedAllocator<T>> _keys;
+        std::vector<usize> _offsets;// Offset of every layer, starting with the leaves
+        usize _size;
+
+        [[nodiscard]] static constexpr auto get_block_count(usize count) noexcept -> usize {
+            return (count + B - 1) / B;
+        }
+
+        [[nodiscard]] static constexpr auto get_parent_count(usize count) noexcept -> usize {
+            return (get_block_count(count) + B) / (B + 1) * B;
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(StaticSearchTree, StaticSearchTree, inline)
+
+        StaticSearchTree() noexcept :
+                _keys {},
+                _offsets {},
+                _size {0} {
+        }
+
+        /**
+         * @param sorted The keys to index, which must be sorted in ascending order.
+         */
+        explicit StaticSearchTree(Slice<const T> sorted) :
+                _keys {},
+                _offsets {},
+                _size {sorted.get_count()} {
+            if(_size == 0) {
+                return;
+            }
+            usize total = 0;
+            for(auto count = _size;; count = get_parent_count(count)) {
+                _offsets.push_back(total);
+                total += get_block_count(count) * B;
+                if(count <= B) {
+                    break;
+                }
+            }
+            _offsets.push_back(total);
+
+            // Padding has to compare greater than or equal to every searchable key, otherwise
+            // the descent would continue into child blocks which do not exist
+            if constexpr(std::numeric_limits<T>::has_infinity) {
+                _keys.resize(total, std::numeric_limits<T>::infinity());
+            }
+            else {
+                _keys.resize(total, std::numeric_limits<T>::max());
+            }
+            std::copy(sorted.begin(), sorted.end(), _keys.begin());
+            for(usize layer = 1; layer + 1 < _offsets.size(); ++layer) {
+                const auto layer_size = _offsets[layer + 1] - _offsets[layer];
+                for(usize index = 0; index < layer_size; ++index) {
+                    // Find the leftmost leaf block of the subtree right of this key
+                    auto block = index / B * (B + 1) + index % B + 1;
+                    for(usize depth = 1; depth < layer; ++depth) {
+                        block *= B + 1;
+                    }
+                    if(block * B < _size) {
+                        _keys[_offsets[layer] + index] = _keys[block * B];
+                    }
+                }
+            }
+        }
+
+        ~StaticSearchTree() noexcept = default;
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _size;
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return _size == 0;
+        }
+
+        [[nodiscard]] inline auto get_height() const noexcept -> usize {
+            return _offsets.empty() ? 0 : _offsets.size() - 1;
+        }
+
+        /**
+         * @return The index of the first key in the original sorted sequence which is
+         *         not less than the given key, or the size of this tree if there is none.
+         */
+        [[nodiscard]] inline auto lower_bound(const T& key) const noexcept -> usize {
+            if(_size == 0) {
+                return 0;
+            }
+            const auto* keys = _keys.data();
+            usize offset = 0;// Offset of the current block within its layer
+            for(auto layer = get_height() - 1; layer > 0; --layer) {
+                const auto index = search::count_less<T, B>(keys + _offsets[layer] + offset, key);
+                offset = offset * (B + 1) + index * B;
+            }
+            return std::min(offset + search::count_less<T, B>(keys + offset, key), _size);
+        }
+
+        [[nodiscard]] inline auto contains(const T& key) const noexcept -> bool {
+            const auto rank = lower_bound(key);
+            return rank < _size && _keys[rank] == key;
+        }
+
+        /**
+         * Looks up multiple keys at once, descending the tree in lockstep
+         * and prefetching the next node of every key before searching any of them.
+         *
+         * @param keys The keys to look up.
+         * @param results The lower bound of every key, as returned by lower_bound.
+         */
+        inline auto lower_bound_many(Slice<const T> keys, Slice<usize> results) const noexcept -> void {
+            const auto count = keys.get_count();
+            assert_true(results.get_count() >= count);
+            const auto* key_data = keys.get_data();
+            auto* result_data = results.get_data();
+            if(_size == 0) {
+                std::fill(result_data, result_data + count, 0);
+                return;
+            }
+            const auto* data = _keys.data();
+            for(usize base = 0; base < count; base += search::batch_size) {
+                const auto batch_count = std::min(search::batch_size, count - base);
+                std::array<usize, search::batch_size> offsets {};
+                for(auto layer = get_height() - 1; layer > 0; --layer) {
+                    for(usize index = 0; index < batch_count; ++index) {
+                        auto& offset = offsets[index];
+                        const auto rank = search::count_less<T, B>(data + _offsets[layer] + offset, key_data[base + index]);
+                        offset = offset * (B + 1) + rank * B;
+                        search::prefetch_at(data, _offsets[layer - 1] + offset);
+                    }
+                }
+                for(usize index = 0; index < batch_count; ++index) {
+                    const auto offset = offsets[index];
+                    result_data[base + index] =
+                            std::min(offset + search::count_less<T, B>(data + offset, key_data[base + index]), _size);
+                }
+            }
+        }
+    };
+}// namespace kstd
@@ -0,0 +1,190 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "defaults.hpp"
+#include "types.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace kstd {
+    /**
+     * Hints the CPU that the calling thread is spinning on a shared variable.
+     */
+    inline auto spin_pause() noexcept -> void {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield" ::: "memory");
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    /**
+     * A sequence lock for read-mostly, trivially copyable snapshots.
+     * Readers never write to shared memory: they copy the value optimistically
+     * and retry if a writer was active in the meantime, so reads scale across
+     * all cores. Writers are serialized among each other through the sequence
+     * counter itself. The value is stored as relaxed atomic words, which keeps
+     * the concurrent copy free of data races in terms of the C++ memory model.
+     *
+     * @tparam T The trivially copyable type of the protected value.
+     */
+    template<typename T>
+    class SeqLock final {
+        static_assert(std::is_trivially_copyable_v<T>, "Type must be trivially copyable");
+        static_assert(std::is_default_constructible_v<T>, "Type must be default constructible");
+
+        public:
+        using ValueType = T;
+        using Self = SeqLock<ValueType>;
+
+        private:
+        static constexpr usize word_count = (sizeof(ValueType) + sizeof(usize) - 1) / sizeof(usize);
+        using WordArray = std::array<usize, word_count>;
+
+        alignas(64) std::atomic<usize> _sequence;
+        std::array<std::atomic<usize>, word_count> _words;
+
+        inline auto store_words(const ValueType& value) noexcept -> void {
+            WordArray words {};
+            std::memcpy(words.data(), &value, sizeof(ValueType));
+            for(usize index = 0; index < word_count; ++index) {
+                _words[index].store(words[index], std::memory_order_relaxed);
+            }
+        }
+
+        [[nodiscard]] inline auto load_words() const noexcept -> ValueType {
+            WordArray words {};
+            for(usize index = 0; index < word_count; ++index) {
+                words[index] = _words[index].load(std::memory_order_relaxed);
+            }
+            ValueType value {};
+            std::memcpy(static_cast<void*>(&value), words.data(), sizeof(ValueType));
+            return value;
+        }
+
+        [[nodiscard]] inline auto lock() noexcept -> usize {
+            auto sequence = _sequence.load(std::memory_order_relaxed);
+            while(true) {
+                if((sequence & 1) != 0) {
+                    spin_pause();
+                    sequence = _sequence.load(std::memory_order_relaxed);
+                    continue;
+                }
+                if(_sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                                   std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            // Keep the stores of the value from being reordered before the odd sequence
+            std::atomic_thread_fence(std::memory_order_release);
+            return sequence;
+        }
+
+        inline auto unlock(usize sequence) noexcept -> void {
+            _sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(SeqLock, Self, constexpr)
+
+        SeqLock() noexcept :
+                SeqLock(ValueType {}) {
+        }
+
+        explicit SeqLock(const ValueType& value) noexcept :
+                _sequence {0},
+                _words {} {
+            store_words(value);
+        }
+
+        ~SeqLock() noexcept = default;
+
+        /**
+         * Attempts to read a consistent copy of the value once.
+         *
+         * @param value The value to copy the snapshot into, only written on success.
+         * @return True if the copy is consistent, false if a writer interfered.
+         */
+        [[nodiscard]] inline auto try_read(ValueType& value) const noexcept -> bool {
+            const auto before = _sequence.load(std::memory_order_acquire);
+            if((before & 1) != 0) {
+                return false;
+            }
+            auto copy = load_words();
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(_sequence.load(std::memory_order_relaxed) != before) {
+                return false;
+            }
+            value = copy;
+            return true;
+        }
+
+        /**
+         * @return A consistent copy of the value, retrying while writers are active.
+         */
+        [[nodiscard]] inline auto read() const noexcept -> ValueType {
+            ValueType value {};
+            while(!try_read(value)) {
+                spin_pause();
+            }
+            return value;
+        }
+
+        inline auto write(const ValueType& value) noexcept -> void {
+            const auto sequence = lock();
+            store_words(value);
+            unlock(sequence);
+        }
+
+        /**
+         * Atomically modifies the value with respect to other writers.
+         *
+         * @tparam F The type of the function to invoke.
+         * @param function A function which receives a mutable reference to a copy of the current value.
+         */
+        template<typename F>
+        inline auto update(F&& function) noexcept -> void {
+            const auto sequence = lock();
+            auto value = load_words();
+            std::forward<F>(function)(value);
+            store_words(value);
+            unlock(sequence);
+        }
+
+        /**
+         * @return The current sequence number, which is incremented by two for every write.
+         */
+        [[nodiscard]] inline auto get_sequence() const noexcept -> usize {
+            return _sequence.load(std::memory_order_acquire);
+        }
+    };
+}// namespace kstd
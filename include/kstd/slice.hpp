@@ -59,6 +59,12 @@ namespace kstd {
                 _size {size} {
         }
 
+        template<typename U, typename = std::enable_if_t<std::is_same_v<const U, ValueType>>>
+        constexpr Slice(Slice<U> other) noexcept :// NOLINT
+                _data {other.get_data()},
+                _size {other.get_size()} {
+        }
+
         template<typename I>
         constexpr Slice(I begin, I end) noexcept :
                 _data {&(*begin)},
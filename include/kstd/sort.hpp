@@ -0,0 +1,387 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bits.hpp"
+#include "slice.hpp"
+#include "types.hpp"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif// __AVX2__
+
+/**
+ * Introspective quicksort over slices.
+ * Ranges which keep producing unbalanced partitions fall back to heapsort,
+ * runs of keys equal to the pivot are split off after a single extra pass
+ * instead of being partitioned over and over again, and small ranges
+ * are finished with insertion sort.
+ * With AVX2, 32-bit keys are partitioned eight at a time in-place.
+ */
+namespace kstd::sorting {
+    constexpr usize insertion_threshold = 24;
+
+    template<typename T, typename LESS>
+    inline auto insertion_sort(T* begin, T* end, LESS& less) -> void {
+        if(begin == end) {
+            return;
+        }
+        for(auto* current = begin + 1; current < end; ++current) {
+            T value = std::move(*current);
+            auto* hole = current;
+            while(hole > begin && less(value, *(hole - 1))) {
+                *hole = std::move(*(hole - 1));
+                --hole;
+            }
+            *hole = std::move(value);
+        }
+    }
+
+    template<typename T, typename LESS>
+    inline auto heap_sort(T* begin, T* end, LESS& less) -> void {
+        std::make_heap(begin, end, less);
+        std::sort_heap(begin, end, less);
+    }
+
+    template<typename T, typename LESS>
+    [[nodiscard]] inline auto median_of_three(T* first, T* second, T* third, LESS& less) -> T* {
+        if(less(*second, *first)) {
+            std::swap(first, second);
+        }
+        if(less(*third, *second)) {
+            return less(*third, *first) ? first : third;
+        }
+        return second;
+    }
+
+    /**
+     * Picks the median of three samples, or the median of three medians (Tukey's ninther) for larger ranges.
+     */
+    template<typename T, typename LESS>
+    [[nodiscard]] inline auto select_pivot(T* begin, T* end, LESS& less) -> T* {
+        const auto size = static_cast<usize>(end - begin);
+        auto* middle = begin + size / 2;
+        auto* last = end - 1;
+        if(size < 128) {
+            return median_of_three(begin, middle, last, less);
+        }
+        const auto step = size / 8;
+        return median_of_three(median_of_three(begin, begin + step, begin + step * 2, less),
+                                median_of_three(middle - step, middle, middle + step, less),
+                                median_of_three(last - step * 2, last - step, last, less), less);
+    }
+
+    /**
+     * Moves all elements which are not greater than the given pivot to the front.
+     *
+     * @return A pointer to the first element greater than the pivot.
+     */
+    template<typename T, typename LESS>
+    [[nodiscard]] inline auto partition_less_equal(T* begin, T* end, const T& pivot, LESS& less) -> T* {
+        return std::partition(begin, end, [&](const T& value) {
+            return !less(pivot, value);
+        });
+    }
+
+    /**
+     * Moves all elements which are less than the given pivot to the front.
+     *
+     * @return A pointer to the first element not less than the pivot.
+     */
+    template<typename T, typename LESS>
+    [[nodiscard]] inline auto partition_less(T* begin, T* end, const T& pivot, LESS& less) -> T* {
+        return std::partition(begin, end, [&](const T& value) {
+            return less(value, pivot);
+        });
+    }
+
+#ifdef __AVX2__
+    /**
+     * For every 8-bit mask of lanes which are greater than the pivot, the packed 3-bit lane
+     * indices which move all other lanes to the front and the masked lanes to the back.
+     */
+    [[nodiscard]] constexpr auto make_partition_table() noexcept -> std::array<u32, 256> {
+        std::array<u32, 256> table {};
+        for(u32 mask = 0; mask < 256; ++mask) {
+            u32 packed = 0;
+            u32 position = 0;
+            for(u32 lane = 0; lane < 8; ++lane) {
+                if((mask & (1U << lane)) == 0) {
+                    packed |= lane << (3 * position++);
+                }
+            }
+            for(u32 lane = 0; lane < 8; ++lane) {
+                if((mask & (1U << lane)) != 0) {
+                    packed |= lane << (3 * position++);
+                }
+            }
+            table[mask] = packed;
+        }
+        return table;
+    }
+
+    inline constexpr std::array<u32, 256> partition_table = make_partition_table();
+
+    inline auto partition_vector(__m256i values, __m256i pivot, i32*& store_left, i32*& store_right) noexcept
+            -> void {
+        const auto greater = _mm256_cmpgt_epi32(values, pivot);
+        const auto mask = static_cast<u32>(_mm256_movemask_ps(_mm256_castsi256_ps(greater)));
+        const auto greater_count = static_cast<isize>(bits::popcount(mask));
+        const auto indices = _mm256_and_si256(
+                _mm256_srlv_epi32(_mm256_set1_epi32(static_cast<i32>(partition_table[mask])),
+                                  _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21)),
+                _mm256_set1_epi32(7));
+        const auto permuted = _mm256_permutevar8x32_epi32(values, indices);
+        // Both sides always have at least 8 free slots, so the lanes past the split are just scratch
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(store_left), permuted);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(store_right - 8), permuted);
+        store_left += 8 - greater_count;
+        store_right -= greater_count;
+    }
+
+    /**
+     * In-place AVX2 partition of 32-bit signed integers.
+     * The first and last vector are read up front, which leaves at least eight free
+     * slots on both ends. After that, every vector is read from the side with fewer
+     * free slots and written out to both ends through a single lane permutation.
+     */
+    [[nodiscard]] inline auto partition_less_equal(i32* begin, i32* end, const i32& pivot, std::less<i32>&) noexcept
+            -> i32* {
+        if(end - begin < 16) {
+            return std::partition(begin, end, [pivot](i32 value) {
+                return value <= pivot;
+            });
+        }
+        const auto pivot_vector = _mm256_set1_epi32(pivot);
+        std::array<i32, 24> rest {};
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(rest.data()),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(rest.data() + 8),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(end - 8)));
+        auto* read_left = begin + 8;
+        auto* read_right = end - 8;
+        auto* store_left = begin;
+        auto* store_right = end;
+
+        while(read_right - read_left >= 8) {
+            __m256i values;
+            if(read_left - store_left <= store_right - read_right) {
+                values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(read_left));
+                read_left += 8;
+            }
+            else {
+                read_right -= 8;
+                values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(read_right));
+            }
+            partition_vector(values, pivot_vector, store_left, store_right);
+        }
+
+        const auto remaining = static_cast<usize>(read_right - read_left);
+        std::copy(read_left, read_right, rest.data() + 16);
+        for(usize index = 0; index < 16 + remaining; ++index) {
+            const auto value = rest[index];
+            if(value <= pivot) {
+                *store_left++ = value;
+            }
+            else {
+                *--store_right = value;
+            }
+        }
+        return store_left;
+    }
+
+    [[nodiscard]] inline auto partition_less(i32* begin, i32* end, const i32& pivot, std::less<i32>& less) noexcept
+            -> i32* {
+        if(pivot == std::numeric_limits<i32>::min()) {
+            return begin;
+        }
+        return partition_less_equal(begin, end, pivot - 1, less);
+    }
+#endif// __AVX2__
+
+    /**
+     * The pivot is moved to the front of the range and partitioned against in place,
+     * so elements are only ever moved and never copied.
+     *
+     * @param upper_bound Points to an element outside of the range when every element of
+     *                    the range is known to be less than or equal to it, which is the
+     *                    pivot of a parent range in its final position.
+     */
+    template<typename T, typename LESS>
+    inline auto quick_sort(T* begin, T* end, LESS& less, usize budget, const T* upper_bound) -> void {
+        while(end - begin > static_cast<isize>(insertion_threshold)) {
+            if(budget == 0) {
+                heap_sort(begin, end, less);
+                return;
+            }
+            std::iter_swap(begin, select_pivot(begin, end, less));
+            if(upper_bound != nullptr && !less(*begin, *upper_bound)) {
+                // The pivot is the maximum, so all of its copies are already in their final place
+                auto* equal = partition_less(begin + 1, end, *begin, less) - 1;
+                std::iter_swap(begin, equal);
+                end = equal;
+                continue;
+            }
+            auto* middle = partition_less_equal(begin + 1, end, *begin, less);
+            auto* pivot = middle - 1;
+            std::iter_swap(begin, pivot);
+            if(middle == end) {
+                end = partition_less(begin, pivot, *pivot, less);
+                continue;
+            }
+
+            const auto left_size = static_cast<usize>(pivot - begin);
+            const auto right_size = static_cast<usize>(end - middle);
+            if(std::min(left_size, right_size) < (left_size + right_size) / 8) {
+                --budget;
+            }
+            // Recurse into the smaller side to bound the stack depth
+            if(left_size < right_size) {
+                sorting::quick_sort(begin, pivot, less, budget, pivot);
+                begin = middle;
+            }
+            else {
+                sorting::quick_sort(middle, end, less, budget, upper_bound);
+                end = pivot;
+                upper_bound = pivot;
+            }
+        }
+        insertion_sort(begin, end, less);
+    }
+
+    template<typename T, typename LESS>
+    inline auto sort(T* begin, T* end, LESS& less) -> void {
+        const auto size = static_cast<usize>(end - begin);
+        usize budget = 0;
+        for(auto remaining = size; remaining > 1; remaining >>= 1) {
+            budget += 2;
+        }
+        quick_sort(begin, end, less, budget, static_cast<const T*>(nullptr));
+    }
+
+    /**
+     * Maps the given key onto a signed integer, so that comparing the results
+     * orders the original keys. Floats end up in their IEEE-754 total order,
+     * which puts -0 before +0 and NaNs at either end depending on their sign.
+     */
+    template<typename T>
+    [[nodiscard]] inline auto to_sort_key(T value) noexcept -> i32 {
+        static_assert(sizeof(T) == sizeof(i32), "Keys must be 32 bits wide");
+        u32 bits {};
+        std::memcpy(&bits, &value, sizeof(u32));
+        if constexpr(std::is_floating_point_v<T>) {
+            bits ^= (bits >> 31) * 0x7FFF'FFFFU;
+        }
+        else if constexpr(std::is_unsigned_v<T>) {
+            bits ^= 0x8000'0000U;
+        }
+        return static_cast<i32>(bits);
+    }
+
+    /**
+     * The inverse of to_sort_key.
+     */
+    template<typename T>
+    [[nodiscard]] inline auto from_sort_key(i32 key) noexcept -> T {
+        auto bits = static_cast<u32>(key);
+        if constexpr(std::is_floating_point_v<T>) {
+            bits ^= (bits >> 31) * 0x7FFF'FFFFU;
+        }
+        else if constexpr(std::is_unsigned_v<T>) {
+            bits ^= 0x8000'0000U;
+        }
+        T value {};
+        std::memcpy(&value, &bits, sizeof(T));
+        return value;
+    }
+}// namespace kstd::sorting
+
+namespace kstd {
+    /**
+     * Sorts the given elements using the given comparison, which is not stable.
+     *
+     * @tparam T The type of the elements to sort.
+     * @tparam LESS The type of the strict weak ordering to sort by.
+     * @param slice The elements to sort.
+     * @param less The strict weak ordering to sort by.
+     */
+    template<typename T, typename LESS>
+    inline auto sort(Slice<T> slice, LESS less) -> void {
+        sorting::sort(slice.begin(), slice.end(), less);
+    }
+
+    /**
+     * Sorts the given elements in ascending order, which is not stable.
+     * 32-bit integers and floats are sorted as signed integers,
+     * which lets them use the vectorized partition if available.
+     * Keys other than i32 are mapped into a temporary buffer for this.
+     * Floats are sorted by their IEEE-754 total order, so unlike with
+     * std::sort, NaNs are allowed and end up at either end.
+     *
+     * @tparam T The type of the elements to sort.
+     * @param slice The elements to sort.
+     */
+    template<typename T>
+    inline auto sort(Slice<T> slice) -> void {
+        auto* begin = slice.begin();
+        auto* end = slice.end();
+        if constexpr(std::is_same_v<T, i32>) {
+            std::less<i32> less {};
+            sorting::sort(begin, end, less);
+        }
+        else if constexpr(std::is_arithmetic_v<T> && sizeof(T) == sizeof(i32)) {
+            // Sort the keys in a separate buffer, accessing the elements as i32 would break strict aliasing
+            std::vector<i32> keys(static_cast<usize>(end - begin));
+            std::transform(begin, end, keys.begin(), sorting::to_sort_key<T>);
+            std::less<i32> less {};
+            sorting::sort(keys.data(), keys.data() + keys.size(), less);
+            std::transform(keys.begin(), keys.end(), begin, sorting::from_sort_key<T>);
+        }
+        else {
+            std::less<T> less {};
+            sorting::sort(begin, end, less);
+        }
+    }
+
+    /**
+     * Sorts the given elements by the keys the given function extracts from them, which is not stable.
+     *
+     * @tparam T The type of the elements to sort.
+     * @tparam F The type of the key function.
+     * @param slice The elements to sort.
+     * @param function The function extracting a comparable key from an element.
+     */
+    template<typename T, typename F>
+    inline auto sort_by_key(Slice<T> slice, F&& function) -> void {
+        auto less = [&function](const T& lhs, const T& rhs) {
+            return function(lhs) < function(rhs);
+        };
+        sorting::sort(slice.begin(), slice.end(), less);
+    }
+}// namespace kstd
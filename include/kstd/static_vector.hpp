@@ -23,6 +23,7 @@
 #include "defaults.hpp"
 #include "types.hpp"
 
+#include <algorithm>
 #include <array>
 #include <iterator>
 #include <utility>
@@ -85,7 +86,7 @@ namespace kstd {
         }
 
         constexpr auto clear() noexcept -> void {
-            std::fill(_data.begin(), _data.end(), {});
+            std::fill(_data.begin(), _data.begin() + _index, ValueType {});
             _index = 0;
         }
 
@@ -110,14 +111,14 @@ namespace kstd {
         template<typename... ARGS>
         constexpr auto emplace_front(ARGS&&... args) noexcept -> void {
             assert_true(_index < size);
-            std::copy(_data.cbegin(), _data.cend() - 1, _data.begin() + 1);
+            std::move_backward(_data.begin(), _data.begin() + _index, _data.begin() + _index + 1);
             _data[0] = ValueType(std::forward<ARGS>(args)...);
             ++_index;
         }
 
         constexpr auto push_front(ValueType value) noexcept -> void {
             assert_true(_index < size);
-            std::copy(_data.cbegin(), _data.cend() - 1, _data.begin() + 1);
+            std::move_backward(_data.begin(), _data.begin() + _index, _data.begin() + _index + 1);
             _data[0] = std::move(value);
             ++_index;
         }
@@ -131,12 +132,20 @@ namespace kstd {
         }
 
         constexpr auto insert(const usize index, ValueType value) noexcept -> void {
-            assert_true(_index < size);
-            std::copy(_data.cbegin() + index, _data.cbegin() + _index, _data.begin() + index + 1);
+            assert_true(_index < size && index <= _index);
+            std::move_backward(_data.begin() + index, _data.begin() + _index, _data.begin() + _index + 1);
             _data[index] = std::move(value);
             ++_index;
         }
 
+        constexpr auto erase(const usize index) noexcept -> ValueType {
+            assert_true(index < _index);
+            auto result = std::move(_data[index]);
+            std::move(_data.begin() + index + 1, _data.begin() + _index, _data.begin() + index);
+            --_index;
+            return result;
+        }
+
         [[nodiscard]] constexpr auto replace(const usize index, ValueType value) noexcept -> ValueType {
             assert_true(_index < size);
             auto result = std::move(_data[index]);
@@ -0,0 +1,253 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+#include "assert.hpp"
+#include "bits.hpp"
+#include "defaults.hpp"
+#include "hash.hpp"
+#include "types.hpp"
+
+// 57-bit virtual addresses (x86-64 LA57, 5-level paging) only leave the upper 7 bits unused.
+// Define KSTD_POINTER_HIGH_BITS to 16 when all targeted systems are known to use 48-bit addresses.
+#ifndef KSTD_POINTER_HIGH_BITS
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64)
+#define KSTD_POINTER_HIGH_BITS 7
+#else
+#define KSTD_POINTER_HIGH_BITS 0
+#endif
+#endif// KSTD_POINTER_HIGH_BITS
+
+namespace kstd {
+    /**
+     * A pointer with a tag (like an ABA counter or a set of flags) packed
+     * into its otherwise unused bits, so it still fits into a single word.
+     * The tag first occupies the low bits which are always zero because of the
+     * alignment of T, and then the upper KSTD_POINTER_HIGH_BITS bits of the address.
+     * On x86-64 and AArch64 these default to 7 bits, which stay unused even with
+     * 57-bit virtual addresses (5-level paging); assuming a 48-bit address space
+     * would silently corrupt pointers on such systems.
+     *
+     * @tparam T The type of the object pointed to.
+     * @tparam TAG_BITS The number of bits available to the tag.
+     */
+    template<typename T, usize TAG_BITS>
+    struct TaggedPtr final {
+        using ElementType = T;
+        using Self = TaggedPtr<ElementType, TAG_BITS>;
+        using Pointer = ElementType*;
+        using Reference = ElementType&;
+
+        static constexpr usize low_bits = bits::count_trailing_zeros(alignof(ElementType));
+        static constexpr usize high_bits = KSTD_POINTER_HIGH_BITS;
+        static constexpr usize tag_bits = TAG_BITS;
+
+        static_assert(TAG_BITS > 0, "At least one tag bit is required");
+        static_assert(TAG_BITS <= low_bits + high_bits, "Not enough unused pointer bits for the requested tag size");
+
+        static constexpr usize tag_low_bits = TAG_BITS < low_bits ? TAG_BITS : low_bits;
+        static constexpr usize tag_high_bits = TAG_BITS - tag_low_bits;
+        static constexpr usize max_tag = (usize {1} << TAG_BITS) - 1;
+
+        friend struct std::hash<Self>;
+
+        private:
+        static constexpr usize low_mask = (usize {1} << tag_low_bits) - 1;
+        static constexpr usize high_shift = (sizeof(usize) << 3) - tag_high_bits;
+        static constexpr usize high_mask = tag_high_bits == 0 ? 0 : ~usize {0} << high_shift;
+        static constexpr usize pointer_mask = ~(low_mask | high_mask);
+
+        usize _value;
+
+        explicit constexpr TaggedPtr(usize value, [[maybe_unused]] bool raw) noexcept :
+                _value {value} {
+        }
+
+        [[nodiscard]] static constexpr auto pack_tag(usize tag) noexcept -> usize {
+            auto value = tag & low_mask;
+            if constexpr(tag_high_bits > 0) {
+                value |= (tag >> tag_low_bits) << high_shift;
+            }
+            return value;
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(TaggedPtr, Self, constexpr)
+
+        constexpr TaggedPtr() noexcept :
+                _value {0} {
+        }
+
+        TaggedPtr(Pointer pointer, usize tag = 0) noexcept :// NOLINT
+                _value {reinterpret_cast<usize>(pointer) | pack_tag(tag)} {
+            assert_true((reinterpret_cast<usize>(pointer) & ~pointer_mask) == 0);
+            assert_true(tag <= max_tag);
+        }
+
+        ~TaggedPtr() noexcept = default;
+
+        [[nodiscard]] static constexpr auto from_raw(usize value) noexcept -> Self {
+            return Self {value, true};
+        }
+
+        [[nodiscard]] constexpr auto get_raw() const noexcept -> usize {
+            return _value;
+        }
+
+        [[nodiscard]] inline auto get() const noexcept -> Pointer {
+            return reinterpret_cast<Pointer>(_value & pointer_mask);// NOLINT
+        }
+
+        [[nodiscard]] constexpr auto get_tag() const noexcept -> usize {
+            auto tag = _value & low_mask;
+            if constexpr(tag_high_bits > 0) {
+                tag |= (_value >> high_shift) << tag_low_bits;
+            }
+            return tag;
+        }
+
+        [[nodiscard]] constexpr auto with_tag(usize tag) const noexcept -> Self {
+            assert_true(tag <= max_tag);
+            return from_raw((_value & pointer_mask) | pack_tag(tag));
+        }
+
+        [[nodiscard]] inline auto with_pointer(Pointer pointer) const noexcept -> Self {
+            return {pointer, get_tag()};
+        }
+
+        /**
+         * @return A copy of this pointer with its tag incremented by one,
+         *  wrapping around once the maximum tag value is exceeded.
+         */
+        [[nodiscard]] constexpr auto with_next_tag() const noexcept -> Self {
+            return with_tag((get_tag() + 1) & max_tag);
+        }
+
+        [[nodiscard]] constexpr auto is_null() const noexcept -> bool {
+            return (_value & pointer_mask) == 0;
+        }
+
+        [[nodiscard]] inline auto operator*() const noexcept -> Reference {
+            return *get();
+        }
+
+        [[nodiscard]] inline auto operator->() const noexcept -> Pointer {
+            return get();
+        }
+
+        [[nodiscard]] constexpr operator bool() const noexcept {// NOLINT
+            return !is_null();
+        }
+
+        [[nodiscard]] constexpr auto operator==(const Self& other) const noexcept -> bool {
+            return _value == other._value;
+        }
+
+        [[nodiscard]] constexpr auto operator!=(const Self& other) const noexcept -> bool {
+            return _value != other._value;
+        }
+    };
+
+    /**
+     * An atomic kstd::TaggedPtr, which allows lock-free algorithms to
+     * compare-and-swap a pointer together with an ABA counter using a
+     * single-word CAS instead of a double-width one.
+     *
+     * @tparam T The type of the object pointed to.
+     * @tparam TAG_BITS The number of bits available to the tag.
+     */
+    template<typename T, usize TAG_BITS>
+    class AtomicTaggedPtr final {
+        public:
+        using ValueType = TaggedPtr<T, TAG_BITS>;
+        using Self = AtomicTaggedPtr<T, TAG_BITS>;
+
+        private:
+        std::atomic<usize> _value;
+
+        public:
+        KSTD_NO_MOVE_COPY(AtomicTaggedPtr, Self, constexpr)
+
+        constexpr AtomicTaggedPtr() noexcept :
+                _value {0} {
+        }
+
+        explicit constexpr AtomicTaggedPtr(ValueType value) noexcept :
+                _value {value.get_raw()} {
+        }
+
+        ~AtomicTaggedPtr() noexcept = default;
+
+        [[nodiscard]] inline auto is_lock_free() const noexcept -> bool {
+            return _value.is_lock_free();
+        }
+
+        [[nodiscard]] inline auto load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+                -> ValueType {
+            return ValueType::from_raw(_value.load(order));
+        }
+
+        inline auto store(ValueType value, std::memory_order order = std::memory_order_seq_cst) noexcept -> void {
+            _value.store(value.get_raw(), order);
+        }
+
+        inline auto exchange(ValueType value, std::memory_order order = std::memory_order_seq_cst) noexcept
+                -> ValueType {
+            return ValueType::from_raw(_value.exchange(value.get_raw(), order));
+        }
+
+        inline auto compare_exchange_weak(ValueType& expected, ValueType desired, std::memory_order success,
+                                          std::memory_order failure) noexcept -> bool {
+            auto raw = expected.get_raw();
+            const auto result = _value.compare_exchange_weak(raw, desired.get_raw(), success, failure);
+            expected = ValueType::from_raw(raw);
+            return result;
+        }
+
+        inline auto compare_exchange_weak(ValueType& expected, ValueType desired,
+                                          std::memory_order order = std::memory_order_seq_cst) noexcept -> bool {
+            auto raw = expected.get_raw();
+            const auto result = _value.compare_exchange_weak(raw, desired.get_raw(), order);
+            expected = ValueType::from_raw(raw);
+            return result;
+        }
+
+        inline auto compare_exchange_strong(ValueType& expected, ValueType desired, std::memory_order success,
+                                            std::memory_order failure) noexcept -> bool {
+            auto raw = expected.get_raw();
+            const auto result = _value.compare_exchange_strong(raw, desired.get_raw(), success, failure);
+            expected = ValueType::from_raw(raw);
+            return result;
+        }
+
+        inline auto compare_exchange_strong(ValueType& expected, ValueType desired,
+                                            std::memory_order order = std::memory_order_seq_cst) noexcept -> bool {
+            auto raw = expected.get_raw();
+            const auto result = _value.compare_exchange_strong(raw, desired.get_raw(), order);
+            expected = ValueType::from_raw(raw);
+            return result;
+        }
+    };
+}// namespace kstd
+
+KSTD_HASH_T(KSTD_TEMPLATE((typename T, kstd::usize TAG_BITS)), (kstd::TaggedPtr<T, TAG_BITS>), kstd::hash(value._value))
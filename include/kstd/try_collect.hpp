@@ -0,0 +1,99 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "result.hpp"
+#include "slice.hpp"
+#include "types.hpp"
+
+namespace kstd {
+    /**
+     * Applies the given function to every element of the given slice and collects
+     * the values of the returned results. The output is allocated once up front,
+     * every value is moved into it and the first error is moved out as-is,
+     * without visiting any of the remaining elements.
+     *
+     * @tparam T The element type of the input slice.
+     * @tparam F The type of the function, which has to return a kstd::Result.
+     * @param slice The input elements.
+     * @param function The function to apply to every element.
+     * @return A vector of all values in input order, or the first error.
+     */
+    template<typename T, typename F, typename R = std::invoke_result_t<F&, T&>>
+    [[nodiscard]] inline auto try_transform(Slice<T> slice, F&& function)
+            -> Result<std::vector<typename R::ValueType>, typename R::ErrorType> {
+        using ValueType = typename R::ValueType;
+        static_assert(!std::is_reference_v<ValueType>, "Function must not return a Result of a reference");
+
+        std::vector<ValueType> values {};
+        values.reserve(slice.get_count());
+        for(auto& element : slice) {
+            auto result = function(element);
+            if(!result) {
+                return std::move(result).template forward<std::vector<ValueType>>();
+            }
+            values.push_back(std::move(*result));
+        }
+        return values;
+    }
+
+    /**
+     * Turns a vector of results into a result of a vector, moving every value
+     * out of the given vector. Stops at the first result which is not ok.
+     *
+     * @return A vector of all values in input order, or the first error.
+     */
+    template<typename T, typename E>
+    [[nodiscard]] inline auto try_collect(std::vector<Result<T, E>>&& results) -> Result<std::vector<T>, E> {
+        std::vector<T> values {};
+        values.reserve(results.size());
+        for(auto& result : results) {
+            if(!result) {
+                return std::move(result).template forward<std::vector<T>>();
+            }
+            values.push_back(std::move(*result));
+        }
+        return values;
+    }
+
+    /**
+     * Turns a slice of results into a result of a vector, copying every value.
+     * Stops at the first result which is not ok.
+     *
+     * @return A vector of all values in input order, or the first error.
+     */
+    template<typename R, typename T = typename std::remove_const_t<R>::ValueType,
+             typename E = typename std::remove_const_t<R>::ErrorType>
+    [[nodiscard]] inline auto try_collect(Slice<R> results) -> Result<std::vector<T>, E> {
+        std::vector<T> values {};
+        values.reserve(results.get_count());
+        for(const auto& result : results) {
+            if(!result) {
+                return result.template forward<std::vector<T>>();
+            }
+            values.push_back(*result);
+        }
+        return values;
+    }
+}// namespace kstd
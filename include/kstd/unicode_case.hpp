@@ -0,0 +1,342 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "types.hpp"
+#include "unicode.hpp"
+#include "unicode_case_tables.hpp"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif// __AVX2__
+
+/**
+ * Simple (one code point to one code point) case mapping as defined
+ * by UnicodeData.txt and the C and S entries of CaseFolding.txt.
+ * Every code point is looked up through a two-level table generated by
+ * tools/generate_unicode_case_tables.py, ASCII is mapped arithmetically
+ * and runs of ASCII in UTF-8 buffers are processed eight (or with AVX2,
+ * thirty-two) bytes at a time.
+ */
+namespace kstd::unicode::casing {
+    enum class CaseMapping : u8 {
+        LOWER,
+        UPPER,
+        FOLD
+    };
+
+    [[nodiscard]] constexpr auto get_record(CodePoint value) noexcept -> const tables::CaseRecord& {
+        if(value >= tables::case_limit) {
+            return tables::case_records[0];
+        }
+        constexpr CodePoint mask = (CodePoint(1) << tables::case_shift) - 1;
+        const auto block = static_cast<usize>(tables::case_stage1[value >> tables::case_shift]);
+        return tables::case_records[tables::case_stage2[(block << tables::case_shift) | (value & mask)]];
+    }
+
+    template<CaseMapping MAPPING>
+    [[nodiscard]] constexpr auto map_ascii(CodePoint value) noexcept -> CodePoint {
+        if constexpr(MAPPING == CaseMapping::UPPER) {
+            return value - 'a' < 26 ? value ^ 0x20 : value;
+        }
+        else {
+            return value - 'A' < 26 ? value ^ 0x20 : value;
+        }
+    }
+
+    template<CaseMapping MAPPING>
+    [[nodiscard]] constexpr auto map(CodePoint value) noexcept -> CodePoint {
+        if(value < 0x80) {
+            return map_ascii<MAPPING>(value);
+        }
+        const auto& record = get_record(value);
+        if constexpr(MAPPING == CaseMapping::LOWER) {
+            return static_cast<CodePoint>(static_cast<i32>(value) + record.lower_delta);
+        }
+        else if constexpr(MAPPING == CaseMapping::UPPER) {
+            return static_cast<CodePoint>(static_cast<i32>(value) + record.upper_delta);
+        }
+        else {
+            return static_cast<CodePoint>(static_cast<i32>(value) + record.fold_delta);
+        }
+    }
+
+    /**
+     * Maps the case of eight ASCII bytes at once.
+     * Since every byte is below 0x80, adding a bias below 0x80 to each of
+     * them never carries into the next one, so the top bit of each byte
+     * tells whether it lies at or above the biased bound.
+     */
+    template<CaseMapping MAPPING>
+    [[nodiscard]] constexpr auto map_ascii_word(u64 word) noexcept -> u64 {
+        constexpr u64 ones = 0x0101'0101'0101'0101ULL;
+        constexpr u64 first = MAPPING == CaseMapping::UPPER ? 'a' : 'A';
+        const auto at_least_first = word + ones * (0x80 - first);
+        const auto above_last = word + ones * (0x80 - first - 26);
+        return word ^ (((at_least_first ^ above_last) & (ones * 0x80)) >> 2);
+    }
+
+#ifdef __AVX2__
+    template<CaseMapping MAPPING>
+    [[nodiscard]] inline auto map_ascii_vector(__m256i vector) noexcept -> __m256i {
+        constexpr char first = MAPPING == CaseMapping::UPPER ? 'a' : 'A';
+        const auto at_least_first = _mm256_cmpgt_epi8(vector, _mm256_set1_epi8(first - 1));
+        const auto above_last = _mm256_cmpgt_epi8(vector, _mm256_set1_epi8(first + 25));
+        const auto in_range = _mm256_andnot_si256(above_last, at_least_first);
+        return _mm256_xor_si256(vector, _mm256_and_si256(in_range, _mm256_set1_epi8(0x20)));
+    }
+#endif// __AVX2__
+
+    /**
+     * Maps the leading run of ASCII code units of the given buffer.
+     *
+     * @return The number of code units which were mapped, may be zero.
+     */
+    template<CaseMapping MAPPING, typename CHAR>
+    inline auto map_ascii_run(const CHAR* data, usize count, CHAR* out) noexcept -> usize {
+        using UnsignedType = std::make_unsigned_t<CHAR>;
+        usize index = 0;
+        if constexpr(sizeof(CHAR) == 1) {
+#ifdef __AVX2__
+            for(; index + 32 <= count; index += 32) {
+                const auto vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));// NOLINT
+                if(_mm256_movemask_epi8(vector) != 0) {
+                    break;
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + index),// NOLINT
+                                    map_ascii_vector<MAPPING>(vector));
+            }
+#endif// __AVX2__
+            for(; index + 8 <= count; index += 8) {
+                u64 word = 0;
+                std::memcpy(&word, data + index, sizeof(u64));
+                if((word & 0x8080'8080'8080'8080ULL) != 0) {
+                    break;
+                }
+                word = map_ascii_word<MAPPING>(word);
+                std::memcpy(out + index, &word, sizeof(u64));
+            }
+        }
+        for(; index < count; ++index) {
+            const auto value = static_cast<UnsignedType>(data[index]);
+            if(value >= 0x80) {
+                break;
+            }
+            out[index] = static_cast<CHAR>(map_ascii<MAPPING>(value));
+        }
+        return index;
+    }
+
+    template<CaseMapping MAPPING, typename CHAR, typename TRAITS>
+    [[nodiscard]] inline auto map_string(std::basic_string_view<CHAR, TRAITS> value)
+            -> std::basic_string<CHAR, TRAITS> {
+        using Traits = UTFTraits<CHAR>;
+        constexpr auto max_width = static_cast<usize>(Traits::max_width);
+
+        std::basic_string<CHAR, TRAITS> result(value.size() + max_width, CHAR {});
+        const auto* current = value.data();
+        const auto* end = current + value.size();
+        usize written = 0;
+
+        const auto grow = [&] {
+            result.resize(result.size() + static_cast<usize>(end - current) + max_width);
+        };
+
+        while(current != end) {
+            if(result.size() == written) {
+                grow();
+            }
+            const auto available = std::min(static_cast<usize>(end - current), result.size() - written);
+            const auto ascii_count = map_ascii_run<MAPPING>(current, available, result.data() + written);
+            current += ascii_count;
+            written += ascii_count;
+            if(current == end || ascii_count == available) {
+                continue;
+            }
+            auto code_point = Traits::decode(current, end);
+            if(code_point == illegal || code_point == incomplete) {
+                code_point = replacement;
+            }
+            // A single code point may grow (U+023A is two bytes, its lower case U+2C65 three),
+            // and the ASCII run before it may have used up the remaining room
+            if(result.size() - written < max_width) {
+                grow();
+            }
+            auto* out = result.data() + written;
+            Traits::encode(map<MAPPING>(code_point), out);
+            written = static_cast<usize>(out - result.data());
+        }
+
+        result.resize(written);
+        return result;
+    }
+
+    template<typename CHAR>
+    [[nodiscard]] inline auto next_folded(const CHAR*& current, const CHAR* end) noexcept -> CodePoint {
+        auto code_point = UTFTraits<CHAR>::decode(current, end);
+        if(code_point == illegal || code_point == incomplete) {
+            return replacement;
+        }
+        return map<CaseMapping::FOLD>(code_point);
+    }
+
+    template<typename CHAR>
+    [[nodiscard]] constexpr auto to_view(const CHAR* value) noexcept -> std::basic_string_view<CHAR> {
+        return value;
+    }
+
+    template<typename CHAR, typename TRAITS>
+    [[nodiscard]] constexpr auto to_view(std::basic_string_view<CHAR, TRAITS> value) noexcept
+            -> std::basic_string_view<CHAR, TRAITS> {
+        return value;
+    }
+
+    template<typename CHAR, typename TRAITS, typename ALLOCATOR>
+    [[nodiscard]] inline auto to_view(const std::basic_string<CHAR, TRAITS, ALLOCATOR>& value) noexcept
+            -> std::basic_string_view<CHAR, TRAITS> {
+        return value;
+    }
+}// namespace kstd::unicode::casing
+
+namespace kstd::unicode {
+    [[nodiscard]] constexpr auto to_lower(CodePoint value) noexcept -> CodePoint {
+        return casing::map<casing::CaseMapping::LOWER>(value);
+    }
+
+    [[nodiscard]] constexpr auto to_upper(CodePoint value) noexcept -> CodePoint {
+        return casing::map<casing::CaseMapping::UPPER>(value);
+    }
+
+    /**
+     * Simple case folding, meant for caseless comparison rather than display.
+     * Unlike full case folding, this never changes the number of code points,
+     * so "ß" does not fold to "ss".
+     */
+    [[nodiscard]] constexpr auto case_fold(CodePoint value) noexcept -> CodePoint {
+        return casing::map<casing::CaseMapping::FOLD>(value);
+    }
+
+    /**
+     * Lower cases every code point of the given UTF-8, UTF-16 or UTF-32 buffer.
+     * Illegal or incomplete sequences are replaced with U+FFFD.
+     */
+    template<typename CHAR, typename TRAITS>
+    [[nodiscard]] inline auto to_lower(std::basic_string_view<CHAR, TRAITS> value) -> std::basic_string<CHAR, TRAITS> {
+        return casing::map_string<casing::CaseMapping::LOWER>(value);
+    }
+
+    template<typename CHAR, typename TRAITS>
+    [[nodiscard]] inline auto to_upper(std::basic_string_view<CHAR, TRAITS> value) -> std::basic_string<CHAR, TRAITS> {
+        return casing::map_string<casing::CaseMapping::UPPER>(value);
+    }
+
+    template<typename CHAR, typename TRAITS>
+    [[nodiscard]] inline auto case_fold(std::basic_string_view<CHAR, TRAITS> value)
+            -> std::basic_string<CHAR, TRAITS> {
+        return casing::map_string<casing::CaseMapping::FOLD>(value);
+    }
+
+    template<typename CHAR, typename TRAITS, typename ALLOCATOR>
+    [[nodiscard]] inline auto to_lower(const std::basic_string<CHAR, TRAITS, ALLOCATOR>& value)
+            -> std::basic_string<CHAR, TRAITS> {
+        return casing::map_string<casing::CaseMapping::LOWER>(std::basic_string_view<CHAR, TRAITS>(value));
+    }
+
+    template<typename CHAR, typename TRAITS, typename ALLOCATOR>
+    [[nodiscard]] inline auto to_upper(const std::basic_string<CHAR, TRAITS, ALLOCATOR>& value)
+            -> std::basic_string<CHAR, TRAITS> {
+        return casing::map_string<casing::CaseMapping::UPPER>(std::basic_string_view<CHAR, TRAITS>(value));
+    }
+
+    template<typename CHAR, typename TRAITS, typename ALLOCATOR>
+    [[nodiscard]] inline auto case_fold(const std::basic_string<CHAR, TRAITS, ALLOCATOR>& value)
+            -> std::basic_string<CHAR, TRAITS> {
+        return casing::map_string<casing::CaseMapping::FOLD>(std::basic_string_view<CHAR, TRAITS>(value));
+    }
+
+    /**
+     * Compares two buffers code point by code point after simple case folding,
+     * without allocating. Both sides may use different encodings, and since
+     * folding may change the width of a code point ("K" and U+212A KELVIN SIGN
+     * are equal), buffers of different lengths may still compare equal.
+     * Illegal or incomplete sequences compare as U+FFFD.
+     */
+    template<typename LHS_CHAR, typename LHS_TRAITS, typename RHS_CHAR, typename RHS_TRAITS>
+    [[nodiscard]] inline auto equals_ignore_case(std::basic_string_view<LHS_CHAR, LHS_TRAITS> lhs,
+                                                 std::basic_string_view<RHS_CHAR, RHS_TRAITS> rhs) noexcept -> bool {
+        constexpr auto fold = casing::CaseMapping::FOLD;
+        const auto* lhs_current = lhs.data();
+        const auto* lhs_end = lhs_current + lhs.size();
+        const auto* rhs_current = rhs.data();
+        const auto* rhs_end = rhs_current + rhs.size();
+
+        if constexpr(sizeof(LHS_CHAR) == 1 && sizeof(RHS_CHAR) == 1) {
+#ifdef __AVX2__
+            while(lhs_end - lhs_current >= 32 && rhs_end - rhs_current >= 32) {
+                const auto lhs_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs_current));// NOLINT
+                const auto rhs_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs_current));// NOLINT
+                if(_mm256_movemask_epi8(_mm256_or_si256(lhs_vector, rhs_vector)) != 0) {
+                    break;
+                }
+                const auto equal = _mm256_cmpeq_epi8(casing::map_ascii_vector<fold>(lhs_vector),
+                                                     casing::map_ascii_vector<fold>(rhs_vector));
+                if(_mm256_movemask_epi8(equal) != -1) {
+                    return false;
+                }
+                lhs_current += 32;
+                rhs_current += 32;
+            }
+#endif// __AVX2__
+            while(lhs_end - lhs_current >= 8 && rhs_end - rhs_current >= 8) {
+                u64 lhs_word = 0;
+                u64 rhs_word = 0;
+                std::memcpy(&lhs_word, lhs_current, sizeof(u64));
+                std::memcpy(&rhs_word, rhs_current, sizeof(u64));
+                if(((lhs_word | rhs_word) & 0x8080'8080'8080'8080ULL) != 0) {
+                    break;
+                }
+                if(casing::map_ascii_word<fold>(lhs_word) != casing::map_ascii_word<fold>(rhs_word)) {
+                    return false;
+                }
+                lhs_current += 8;
+                rhs_current += 8;
+            }
+        }
+
+        while(lhs_current != lhs_end && rhs_current != rhs_end) {
+            if(casing::next_folded(lhs_current, lhs_end) !=
+               casing::next_folded(rhs_current, rhs_end)) {
+                return false;
+            }
+        }
+        return lhs_current == lhs_end && rhs_current == rhs_end;
+    }
+
+    template<typename LHS, typename RHS>
+    [[nodiscard]] inline auto equals_ignore_case(const LHS& lhs, const RHS& rhs) noexcept -> bool {
+        return equals_ignore_case(casing::to_view(lhs), casing::to_view(rhs));
+    }
+}// namespace kstd::unicode
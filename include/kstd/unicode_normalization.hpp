@@ -0,0 +1,424 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "types.hpp"
+#include "unicode.hpp"
+#include "unicode_normalization_tables.hpp"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif// __AVX2__
+
+/**
+ * Canonical normalization (NFC and NFD) as described in UAX #15.
+ * Input is first run through the quick check, which skips runs of code
+ * units below the first code point that is not a stable starter in bulk.
+ * Only the segments around code points which fail the quick check are
+ * decomposed, reordered and (for NFC) recomposed, everything in between
+ * is copied over verbatim.
+ */
+namespace kstd::unicode::normalization {
+    // Hangul syllables are (de)composed algorithmically, see chapter 3.12 of the Unicode standard
+    constexpr CodePoint hangul_syllable_base = 0xAC00;
+    constexpr CodePoint hangul_leading_base = 0x1100;
+    constexpr CodePoint hangul_vowel_base = 0x1161;
+    constexpr CodePoint hangul_trailing_base = 0x11A7;
+    constexpr CodePoint hangul_leading_count = 19;
+    constexpr CodePoint hangul_vowel_count = 21;
+    constexpr CodePoint hangul_trailing_count = 28;
+    constexpr CodePoint hangul_block_count = hangul_vowel_count * hangul_trailing_count;
+    constexpr CodePoint hangul_syllable_count = hangul_leading_count * hangul_block_count;
+
+    [[nodiscard]] constexpr auto get_record(CodePoint value) noexcept -> const tables::NormalizationRecord& {
+        if(value >= tables::normalization_limit) {
+            return tables::normalization_records[0];
+        }
+        constexpr CodePoint mask = (CodePoint(1) << tables::normalization_shift) - 1;
+        const auto block = static_cast<usize>(tables::normalization_stage1[value >> tables::normalization_shift]);
+        return tables::normalization_records[tables::normalization_stage2[(block << tables::normalization_shift) |
+                                                                          (value & mask)]];
+    }
+
+    [[nodiscard]] constexpr auto get_combining_class(CodePoint value) noexcept -> u8 {
+        return get_record(value).combining_class;
+    }
+
+    /**
+     * Appends the full canonical decomposition of the given code point.
+     */
+    template<typename STRING>
+    inline auto decompose(CodePoint value, STRING& out) -> void {
+        if(value - hangul_syllable_base < hangul_syllable_count) {
+            const auto index = value - hangul_syllable_base;
+            out.push_back(hangul_leading_base + index / hangul_block_count);
+            out.push_back(hangul_vowel_base + (index % hangul_block_count) / hangul_trailing_count);
+            if(const auto trailing = index % hangul_trailing_count; trailing != 0) {
+                out.push_back(hangul_trailing_base + trailing);
+            }
+            return;
+        }
+        if((get_record(value).flags & tables::nfd_quick_check_no) == 0) {
+            out.push_back(value);
+            return;
+        }
+        const auto* keys_end = tables::decomposition_keys.data() + tables::decomposition_keys.size();
+        const auto* key = std::lower_bound(tables::decomposition_keys.data(), keys_end, static_cast<u32>(value));
+        const auto index = static_cast<usize>(key - tables::decomposition_keys.data());
+        for(auto offset = tables::decomposition_offsets[index]; offset < tables::decomposition_offsets[index + 1];
+            ++offset) {
+            out.push_back(static_cast<CodePoint>(tables::decomposition_data[offset]));
+        }
+    }
+
+    /**
+     * @return The primary composite of the given pair, or unicode::illegal if there is none.
+     */
+    [[nodiscard]] inline auto compose(CodePoint first, CodePoint second) noexcept -> CodePoint {
+        if(first - hangul_leading_base < hangul_leading_count && second - hangul_vowel_base < hangul_vowel_count) {
+            return hangul_syllable_base + ((first - hangul_leading_base) * hangul_vowel_count +
+                                           (second - hangul_vowel_base)) *
+                                                  hangul_trailing_count;
+        }
+        if(first - hangul_syllable_base < hangul_syllable_count &&
+           (first - hangul_syllable_base) % hangul_trailing_count == 0 &&
+           second - hangul_trailing_base - 1 < hangul_trailing_count - 1) {
+            return first + (second - hangul_trailing_base);
+        }
+        const auto key = (static_cast<u64>(first) << 32) | second;
+        const auto* keys_end = tables::composition_keys.data() + tables::composition_keys.size();
+        const auto* match = std::lower_bound(tables::composition_keys.data(), keys_end, key);
+        if(match == keys_end || *match != key) {
+            return illegal;
+        }
+        const auto index = static_cast<usize>(match - tables::composition_keys.data());
+        return static_cast<CodePoint>(tables::composition_values[index]);
+    }
+
+    /**
+     * Sorts every run of non-starters by their combining class, keeping equal classes in order.
+     */
+    inline auto reorder(CodePoint* data, usize count) noexcept -> void {
+        for(usize index = 1; index < count; ++index) {
+            const auto value = data[index];
+            const auto combining_class = get_combining_class(value);
+            if(combining_class == 0) {
+                continue;
+            }
+            auto hole = index;
+            while(hole > 0 && get_combining_class(data[hole - 1]) > combining_class) {
+                data[hole] = data[hole - 1];
+                --hole;
+            }
+            data[hole] = value;
+        }
+    }
+
+    /**
+     * Canonical composition of an already decomposed and reordered buffer.
+     *
+     * @return The number of code points left after composing.
+     */
+    inline auto recompose(CodePoint* data, usize count) noexcept -> usize {
+        if(count == 0) {
+            return 0;
+        }
+        usize starter = 0;
+        usize written = 1;
+        // A leading non-starter blocks every following code point from composing with it
+        u32 last_class = get_combining_class(data[0]) == 0 ? 0 : 256;
+        for(usize index = 1; index < count; ++index) {
+            const auto value = data[index];
+            const auto combining_class = get_combining_class(value);
+            if(last_class < combining_class || last_class == 0) {
+                if(const auto composite = compose(data[starter], value); composite != illegal) {
+                    data[starter] = composite;
+                    continue;
+                }
+            }
+            if(combining_class == 0) {
+                starter = written;
+            }
+            last_class = combining_class;
+            data[written++] = value;
+        }
+        return written;
+    }
+
+    [[nodiscard]] constexpr auto get_stable_limit(bool compose) noexcept -> CodePoint {
+        return compose ? tables::nfc_stable_limit : tables::nfd_stable_limit;
+    }
+
+    [[nodiscard]] constexpr auto get_failing_flags(bool compose) noexcept -> u8 {
+        return compose ? tables::nfc_quick_check_no | tables::nfc_quick_check_maybe : tables::nfd_quick_check_no;
+    }
+
+    /**
+     * Skips the leading run of code units which encode code points below the given
+     * limit on their own. Every such code point is a starter which never changes
+     * under normalization and never interacts with its neighbours.
+     *
+     * @return The number of code units which were skipped, may be zero.
+     */
+    template<typename CHAR>
+    [[nodiscard]] inline auto skip_stable(const CHAR* data, usize count, CodePoint limit) noexcept -> usize {
+        using UnsignedType = std::make_unsigned_t<CHAR>;
+        usize index = 0;
+        if constexpr(sizeof(CHAR) == 1) {
+            limit = std::min<CodePoint>(limit, 0x80);// Multi-byte sequences are never skipped in bulk
+#ifdef __AVX2__
+            for(; index + 32 <= count; index += 32) {
+                const auto vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));// NOLINT
+                if(_mm256_movemask_epi8(vector) != 0) {
+                    break;
+                }
+            }
+#endif// __AVX2__
+            for(; index + 8 <= count; index += 8) {
+                u64 word = 0;
+                std::memcpy(&word, data + index, sizeof(u64));
+                if((word & 0x8080'8080'8080'8080ULL) != 0) {
+                    break;
+                }
+            }
+        }
+#ifdef __AVX2__
+        else if constexpr(sizeof(CHAR) == 2) {
+            const auto maximum = _mm256_set1_epi16(static_cast<i16>(limit - 1));
+            for(; index + 16 <= count; index += 16) {
+                const auto vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));// NOLINT
+                const auto in_range = _mm256_cmpeq_epi16(_mm256_max_epu16(vector, maximum), maximum);
+                if(_mm256_movemask_epi8(in_range) != -1) {
+                    break;
+                }
+            }
+        }
+        else {
+            const auto maximum = _mm256_set1_epi32(static_cast<i32>(limit - 1));
+            for(; index + 8 <= count; index += 8) {
+                const auto vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));// NOLINT
+                const auto in_range = _mm256_cmpeq_epi32(_mm256_max_epu32(vector, maximum), maximum);
+                if(_mm256_movemask_epi8(in_range) != -1) {
+                    break;
+                }
+            }
+        }
+#endif// __AVX2__
+        while(index < count && static_cast<CodePoint>(static_cast<UnsignedType>(data[index])) < limit) {
+            ++index;
+        }
+        return index;
+    }
+
+    /**
+     * Finds the first code point of the given buffer which fails the quick check
+     * for the given form. Runs of stable code units are skipped in bulk.
+     *
+     * @param segment_start Receives the start of the last code point before the
+     *                      failing one which is a stable starter, or the start of
+     *                      the buffer if there is none. Normalization has to restart there.
+     * @param maybe Set to true if any code point may need to be composed with its predecessor.
+     *              If this is null, such code points fail the check instead.
+     * @return The start of the first failing code point, or end if there is none.
+     */
+    template<typename CHAR>
+    [[nodiscard]] inline auto find_unstable(const CHAR* current, const CHAR* end, bool compose,
+                                            const CHAR*& segment_start, bool* maybe) noexcept -> const CHAR* {
+        const auto limit = get_stable_limit(compose);
+        const auto failing_flags = get_failing_flags(compose);
+        segment_start = current;
+        u8 last_class = 0;
+        while(current != end) {
+            if(const auto skipped = skip_stable(current, static_cast<usize>(end - current), limit); skipped != 0) {
+                current += skipped;
+                segment_start = current - 1;
+                last_class = 0;
+                continue;
+            }
+            const auto* start = current;
+            const auto value = UTFTraits<CHAR>::decode(current, end);
+            if(value == illegal || value == incomplete) {
+                return start;
+            }
+            const auto& record = get_record(value);
+            if(record.combining_class != 0 && last_class > record.combining_class) {
+                return start;
+            }
+            if((record.flags & failing_flags) != 0) {
+                if(!compose || maybe == nullptr || (record.flags & tables::nfc_quick_check_no) != 0) {
+                    return start;
+                }
+                *maybe = true;
+            }
+            else if(record.combining_class == 0) {
+                segment_start = start;
+            }
+            last_class = record.combining_class;
+        }
+        return end;
+    }
+
+    /**
+     * @return The end of the segment starting with the given failing code point, which
+     *         is the start of the next stable starter following it, or end if there is none.
+     */
+    template<typename CHAR>
+    [[nodiscard]] inline auto find_segment_end(const CHAR* current, const CHAR* end, bool compose) noexcept
+            -> const CHAR* {
+        const auto failing_flags = get_failing_flags(compose);
+        static_cast<void>(UTFTraits<CHAR>::decode(current, end));// Skip the failing code point itself
+        while(current != end) {
+            const auto* start = current;
+            const auto value = UTFTraits<CHAR>::decode(current, end);
+            if(value == illegal || value == incomplete) {
+                continue;
+            }
+            const auto& record = get_record(value);
+            if(record.combining_class == 0 && (record.flags & failing_flags) == 0) {
+                return start;
+            }
+        }
+        return end;
+    }
+
+    template<typename CHAR, typename TRAITS>
+    inline auto normalize_segment(const CHAR* current, const CHAR* end, bool compose, std::u32string& buffer,
+                                  std::basic_string<CHAR, TRAITS>& out) -> void {
+        buffer.clear();
+        while(current != end) {
+            const auto value = UTFTraits<CHAR>::decode(current, end);
+            decompose(value == illegal || value == incomplete ? replacement : value, buffer);
+        }
+        reorder(buffer.data(), buffer.size());
+        const auto count = compose ? recompose(buffer.data(), buffer.size()) : buffer.size();
+        auto inserter = std::back_inserter(out);
+        for(usize index = 0; index < count; ++index) {
+            UTFTraits<CHAR>::encode(buffer[index], inserter);
+        }
+    }
+
+    template<typename CHAR, typename TRAITS>
+    [[nodiscard]] inline auto normalize(std::basic_string_view<CHAR, TRAITS> value, bool compose)
+            -> std::basic_string<CHAR, TRAITS> {
+        const auto* current = value.data();
+        const auto* end = current + value.size();
+        std::basic_string<CHAR, TRAITS> result {};
+        std::u32string buffer {};
+        result.reserve(value.size());
+
+        while(current != end) {
+            const CHAR* segment_start = nullptr;
+            const auto* unstable = find_unstable(current, end, compose, segment_start, nullptr);
+            if(unstable == end) {
+                result.append(current, static_cast<usize>(end - current));
+                break;
+            }
+            result.append(current, static_cast<usize>(segment_start - current));
+            const auto* segment_end = find_segment_end(unstable, end, compose);
+            normalize_segment(segment_start, segment_end, compose, buffer, result);
+            current = segment_end;
+        }
+        return result;
+    }
+}// namespace kstd::unicode::normalization
+
+namespace kstd::unicode {
+    enum class NormalForm : u8 {
+        NFC,
+        NFD
+    };
+
+    enum class QuickCheck : u8 {
+        YES,
+        NO,
+        MAYBE
+    };
+
+    [[nodiscard]] constexpr auto get_combining_class(CodePoint value) noexcept -> u8 {
+        return normalization::get_combining_class(value);
+    }
+
+    /**
+     * Checks whether the given buffer is in the given normal form without allocating.
+     * Illegal or incomplete sequences always fail the check.
+     *
+     * @return QuickCheck::MAYBE if the buffer contains code points which might
+     *         compose with their predecessor, which can only happen for NFC.
+     */
+    template<typename CHAR, typename TRAITS>
+    [[nodiscard]] inline auto quick_check(std::basic_string_view<CHAR, TRAITS> value, NormalForm form) noexcept
+            -> QuickCheck {
+        const auto* end = value.data() + value.size();
+        const CHAR* segment_start = nullptr;
+        bool maybe = false;
+        if(normalization::find_unstable(value.data(), end, form == NormalForm::NFC, segment_start, &maybe) != end) {
+            return QuickCheck::NO;
+        }
+        return maybe ? QuickCheck::MAYBE : QuickCheck::YES;
+    }
+
+    template<typename CHAR, typename TRAITS, typename ALLOCATOR>
+    [[nodiscard]] inline auto quick_check(const std::basic_string<CHAR, TRAITS, ALLOCATOR>& value,
+                                          NormalForm form) noexcept -> QuickCheck {
+        return quick_check(std::basic_string_view<CHAR, TRAITS>(value), form);
+    }
+
+    /**
+     * Like unicode::quick_check, but resolves QuickCheck::MAYBE
+     * by normalizing the buffer, which allocates.
+     */
+    template<typename CHAR, typename TRAITS>
+    [[nodiscard]] inline auto is_normalized(std::basic_string_view<CHAR, TRAITS> value, NormalForm form) -> bool {
+        const auto result = quick_check(value, form);
+        if(result != QuickCheck::MAYBE) {
+            return result == QuickCheck::YES;
+        }
+        return normalization::normalize(value, form == NormalForm::NFC) == value;
+    }
+
+    template<typename CHAR, typename TRAITS, typename ALLOCATOR>
+    [[nodiscard]] inline auto is_normalized(const std::basic_string<CHAR, TRAITS, ALLOCATOR>& value, NormalForm form)
+            -> bool {
+        return is_normalized(std::basic_string_view<CHAR, TRAITS>(value), form);
+    }
+
+    /**
+     * Converts the given UTF-8, UTF-16 or UTF-32 buffer into the given normal form.
+     * Illegal or incomplete sequences are replaced with U+FFFD.
+     */
+    template<typename CHAR, typename TRAITS>
+    [[nodiscard]] inline auto normalize(std::basic_string_view<CHAR, TRAITS> value, NormalForm form)
+            -> std::basic_string<CHAR, TRAITS> {
+        return normalization::normalize(value, form == NormalForm::NFC);
+    }
+
+    template<typename CHAR, typename TRAITS, typename ALLOCATOR>
+    [[nodiscard]] inline auto normalize(const std::basic_string<CHAR, TRAITS, ALLOCATOR>& value, NormalForm form)
+            -> std::basic_string<CHAR, TRAITS> {
+        return normalization::normalize(std::basic_string_view<CHAR, TRAITS>(value), form == NormalForm::NFC);
+    }
+}// namespace kstd::unicode
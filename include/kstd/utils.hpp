@@ -79,4 +79,32 @@ namespace kstd::utils {
     [[nodiscard]] inline auto to_mbs(const std::wstring& value) noexcept -> std::basic_string<char, TRAITS, ALLOCATOR> {
         return unicode::convert<char, TRAITS, ALLOCATOR>(value);
     }
+
+    /**
+     * Hints the CPU to fetch the cache line containing the given address for reading.
+     * This never faults, so the address does not need to be valid.
+     *
+     * @param address The address to prefetch.
+     */
+    inline auto prefetch(const void* address) noexcept -> void {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#else
+        static_cast<void>(address);
+#endif
+    }
+
+    /**
+     * Hints the CPU to fetch the cache line containing the given address for writing.
+     * This never faults, so the address does not need to be valid.
+     *
+     * @param address The address to prefetch.
+     */
+    inline auto prefetch_write(const void* address) noexcept -> void {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 1);
+#else
+        static_cast<void>(address);
+#endif
+    }
 }// namespace kstd::utils
\ No newline at end of file
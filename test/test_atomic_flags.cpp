@@ -0,0 +1,84 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/atomic_flags.hpp>
+#include <thread>
+#include <vector>
+
+KSTD_BITFLAGS(kstd::u8, StateFlags, CONNECTED = 1U << 0, AUTHENTICATED = 1U << 1, CLOSING = 1U << 2)
+
+using namespace kstd;
+
+TEST(kstd_AtomicFlags, test_fetch_set_clear) {
+    AtomicFlags<StateFlags> flags {};
+    ASSERT_EQ(flags.fetch_set(StateFlags::CONNECTED), StateFlags::NONE);
+    ASSERT_EQ(flags.fetch_set(StateFlags::AUTHENTICATED, std::memory_order_acq_rel), StateFlags::CONNECTED);
+    ASSERT_TRUE(flags.test(StateFlags::CONNECTED | StateFlags::AUTHENTICATED));
+    ASSERT_EQ(flags.fetch_clear(StateFlags::CONNECTED, std::memory_order_release),
+              StateFlags::CONNECTED | StateFlags::AUTHENTICATED);
+    ASSERT_EQ(flags.load(std::memory_order_acquire), StateFlags::AUTHENTICATED);
+}
+
+TEST(kstd_AtomicFlags, test_test_and_set) {
+    AtomicFlags<StateFlags> flags {StateFlags::CONNECTED};
+    ASSERT_FALSE(flags.test_and_set(StateFlags::CLOSING));
+    ASSERT_TRUE(flags.test_and_set(StateFlags::CLOSING));
+    ASSERT_FALSE(flags.test_and_set(StateFlags::CLOSING | StateFlags::AUTHENTICATED));
+}
+
+TEST(kstd_AtomicFlags, test_compare_exchange) {
+    AtomicFlags<StateFlags> flags {StateFlags::CONNECTED};
+    auto expected = StateFlags::NONE;
+    ASSERT_FALSE(flags.compare_exchange(expected, StateFlags::CLOSING));
+    ASSERT_EQ(expected, StateFlags::CONNECTED);
+    ASSERT_TRUE(flags.compare_exchange(expected, StateFlags::CLOSING, std::memory_order_acq_rel));
+    ASSERT_EQ(flags.load(), StateFlags::CLOSING);
+}
+
+TEST(kstd_AtomicFlags, test_concurrent_set) {
+    AtomicFlags<StateFlags> flags {};
+    std::vector<std::thread> threads {};
+    for(const auto flag : {StateFlags::CONNECTED, StateFlags::AUTHENTICATED, StateFlags::CLOSING}) {
+        threads.emplace_back([&flags, flag] {
+            for(usize index = 0; index < 10'000; ++index) {
+                flags.fetch_set(flag, std::memory_order_relaxed);
+                flags.fetch_clear(flag, std::memory_order_relaxed);
+            }
+            flags.fetch_set(flag, std::memory_order_relaxed);
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(flags.load(), StateFlags::CONNECTED | StateFlags::AUTHENTICATED | StateFlags::CLOSING);
+}
+
+TEST(kstd_AtomicFlags, test_wait_until_set) {
+    AtomicFlags<StateFlags> flags {};
+    std::thread waiter([&flags] {
+        const auto value = flags.wait_until_set(StateFlags::CONNECTED | StateFlags::AUTHENTICATED);
+        ASSERT_TRUE(contains(value, StateFlags::CONNECTED | StateFlags::AUTHENTICATED));
+    });
+    flags.fetch_set(StateFlags::CONNECTED);
+    std::this_thread::yield();
+    flags.fetch_set(StateFlags::AUTHENTICATED);
+    waiter.join();
+    ASSERT_EQ(flags.wait_until_set(StateFlags::CONNECTED), StateFlags::CONNECTED | StateFlags::AUTHENTICATED);
+}
@@ -20,6 +20,7 @@
 #include <gtest/gtest.h>
 #include <kstd/bitflags.hpp>
 #include <kstd/types.hpp>
+#include <vector>
 
 KSTD_BITFLAGS(kstd::u8, SomeFlags, FOO = 0b0000'0001, BAR = 0b0000'0010, BAZ = 0b0000'0100)
 
@@ -30,4 +31,42 @@ TEST(kstd, test_bit_flags) {
     flags |= SomeFlags::BAZ;
     flags &= ~SomeFlags::FOO;
     ASSERT_EQ(flags, SomeFlags::BAZ);
-}
\ No newline at end of file
+}
+
+KSTD_BITFLAGS(kstd::u32, WideFlags, A = 1U << 0, B = 1U << 5, C = 1U << 31, AB = A | B)
+
+TEST(kstd, test_bit_flags_queries) {
+    constexpr auto flags = SomeFlags::FOO | SomeFlags::BAZ;
+    static_assert(contains(flags, SomeFlags::FOO));
+    static_assert(!contains(flags, SomeFlags::FOO | SomeFlags::BAR));
+    static_assert(any(flags, SomeFlags::BAR | SomeFlags::BAZ));
+    static_assert(!any(flags, SomeFlags::BAR));
+    static_assert(!any(SomeFlags::NONE));
+    static_assert(count(flags) == 2);
+    static_assert(count(WideFlags::A | WideFlags::B | WideFlags::C) == 3);
+    static_assert(kstd::is_bitflags_v<SomeFlags>);
+    static_assert(!kstd::is_bitflags_v<kstd::u32>);
+}
+
+TEST(kstd, test_bit_flags_for_each_set) {
+    std::vector<WideFlags> values {};
+    for_each_set(WideFlags::C | WideFlags::A | WideFlags::B, [&values](const WideFlags flag) {
+        values.push_back(flag);
+    });
+    ASSERT_EQ(values.size(), 3);
+    ASSERT_EQ(values[0], WideFlags::A);
+    ASSERT_EQ(values[1], WideFlags::B);
+    ASSERT_EQ(values[2], WideFlags::C);
+}
+
+TEST(kstd, test_bit_flags_to_string) {
+    constexpr auto entries = kstd_get_bitflags_entries(WideFlags::NONE);
+    static_assert(entries.size() == 4);
+    static_assert(entries[1].name == "B");
+    static_assert(entries[3].value == (WideFlags::A | WideFlags::B));
+
+    ASSERT_EQ(to_string(SomeFlags::NONE), "NONE");
+    ASSERT_EQ(to_string(SomeFlags::FOO | SomeFlags::BAZ), "FOO | BAZ");
+    ASSERT_EQ(to_string(static_cast<SomeFlags>(0b1000'0010)), "BAR | 0x80");
+    ASSERT_EQ(fmt::format("{}", WideFlags::AB | WideFlags::C), "A | B | C");
+}
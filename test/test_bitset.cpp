@@ -0,0 +1,135 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/bitset.hpp>
+#include <vector>
+
+using namespace kstd;
+
+TEST(kstd_Bitset, test_set_test) {
+    Bitset<130> bits {};
+    ASSERT_EQ(Bitset<130>::word_count, 3);
+    ASSERT_TRUE(bits.none());
+    bits.set(0);
+    bits.set(64);
+    bits.set(129);
+    ASSERT_TRUE(bits.test(0));
+    ASSERT_TRUE(bits[64]);
+    ASSERT_FALSE(bits.test(63));
+    ASSERT_EQ(bits.count(), 3);
+    bits.reset(64);
+    ASSERT_EQ(bits.count(), 2);
+    bits.flip(1);
+    ASSERT_TRUE(bits.test(1));
+}
+
+TEST(kstd_Bitset, test_set_all_trims) {
+    Bitset<70> bits {};
+    bits.set_all();
+    ASSERT_EQ(bits.count(), 70);
+    ASSERT_TRUE(bits.all());
+    const auto inverted = ~bits;
+    ASSERT_TRUE(inverted.none());
+    ASSERT_EQ(bits.get_words()[1], (u64 {1} << 6) - 1);
+}
+
+TEST(kstd_Bitset, test_bulk_operations) {
+    Bitset<1000> a {};
+    Bitset<1000> b {};
+    for(usize index = 0; index < 1000; index += 2) {
+        a.set(index);
+    }
+    for(usize index = 0; index < 1000; index += 3) {
+        b.set(index);
+    }
+    ASSERT_EQ((a & b).count(), 167);
+    ASSERT_EQ((a | b).count(), 500 + 334 - 167);
+    ASSERT_EQ((a ^ b).count(), 500 + 334 - 2 * 167);
+    auto c = a;
+    c.and_not(b);
+    ASSERT_EQ(c.count(), 500 - 167);
+    ASSERT_TRUE(c.test(2));
+    ASSERT_FALSE(c.test(6));
+}
+
+TEST(kstd_Bitset, test_find) {
+    Bitset<300> bits {};
+    ASSERT_FALSE(bits.find_first());
+    bits.set(5);
+    bits.set(200);
+    bits.set(299);
+    ASSERT_EQ(*bits.find_first(), 5);
+    ASSERT_EQ(*bits.find_next(6), 200);
+    ASSERT_EQ(*bits.find_next(200), 200);
+    ASSERT_EQ(*bits.find_next(201), 299);
+    ASSERT_FALSE(bits.find_next(300));
+
+    std::vector<usize> indices {};
+    bits.for_each_set([&indices](const usize index) {
+        indices.push_back(index);
+    });
+    ASSERT_EQ(indices, (std::vector<usize> {5, 200, 299}));
+}
+
+TEST(kstd_DynamicBitset, test_resize) {
+    DynamicBitset bits {10};
+    ASSERT_EQ(bits.get_size(), 10);
+    bits.set(3);
+    bits.resize(100, true);
+    ASSERT_EQ(bits.count(), 91);
+    ASSERT_FALSE(bits.test(9));
+    ASSERT_TRUE(bits.test(10));
+    bits.resize(5);
+    ASSERT_EQ(bits.count(), 1);
+    bits.push_back(true);
+    ASSERT_EQ(bits.get_size(), 6);
+    ASSERT_TRUE(bits.test(5));
+}
+
+TEST(kstd_DynamicBitset, test_bulk_operations) {
+    DynamicBitset a {777};
+    DynamicBitset b {777};
+    for(usize index = 0; index < 777; index += 7) {
+        a.set(index);
+    }
+    b.set_all();
+    ASSERT_EQ((a & b), a);
+    ASSERT_EQ((a | b), b);
+    ASSERT_EQ((a ^ b).count(), 777 - a.count());
+    ASSERT_EQ((~b).count(), 0);
+    ASSERT_EQ(*a.find_next(1), 7);
+}
+
+TEST(kstd_RankSelectIndex, test_rank_select) {
+    DynamicBitset bits {5000};
+    std::vector<usize> positions {};
+    for(usize index = 3; index < 5000; index += 37) {
+        bits.set(index);
+        positions.push_back(index);
+    }
+    const RankSelectIndex index {bits.get_words()};
+    ASSERT_EQ(index.get_count(), positions.size());
+    for(usize rank = 0; rank < positions.size(); ++rank) {
+        ASSERT_EQ(*index.select(rank), positions[rank]);
+        ASSERT_EQ(index.rank(positions[rank]), rank);
+        ASSERT_EQ(index.rank(positions[rank] + 1), rank + 1);
+    }
+    ASSERT_FALSE(index.select(positions.size()));
+}
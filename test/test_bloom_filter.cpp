@@ -0,0 +1,84 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/bloom_filter.hpp>
+#include <vector>
+
+using namespace kstd;
+
+TEST(kstd_BloomFilter, test_insert_contains) {
+    BloomFilter filter {10'000, 0.01};
+    ASSERT_EQ(filter.get_block_count(), 375);
+
+    for(u64 index = 0; index < 10'000; ++index) {
+        filter.insert(index);
+    }
+    for(u64 index = 0; index < 10'000; ++index) {
+        ASSERT_TRUE(filter.contains(index));
+    }
+
+    usize false_positives = 0;
+    for(u64 index = 10'000; index < 110'000; ++index) {
+        if(filter.contains(index)) {
+            ++false_positives;
+        }
+    }
+    ASSERT_LT(false_positives, 2'000);// Below 2%, split block filters trade some accuracy for locality
+
+    filter.clear();
+    ASSERT_FALSE(filter.contains(u64 {1}));
+}
+
+TEST(kstd_BloomFilter, test_merge) {
+    BloomFilter first {1000};
+    BloomFilter second {1000};
+    first.insert(1);
+    second.insert(2);
+    ASSERT_TRUE(first.merge(second));
+    ASSERT_TRUE(first.contains(1));
+    ASSERT_TRUE(first.contains(2));
+    ASSERT_FALSE(first.merge(BloomFilter::with_block_count(1)));
+}
+
+TEST(kstd_BloomFilter, test_serialize) {
+    BloomFilter filter {1000};
+    for(u32 index = 0; index < 1000; ++index) {
+        filter.insert(index * 7);
+    }
+
+    std::vector<BloomFilter::Block> storage(filter.get_block_count() + 1);
+    Slice<u8> buffer {reinterpret_cast<u8*>(storage.data()), storage.size() * sizeof(BloomFilter::Block)};
+    ASSERT_FALSE(filter.serialize({buffer.get_data(), 16}));
+    ASSERT_EQ(*filter.serialize(buffer), filter.get_serialized_size());
+
+    auto view = BloomFilterView::from_bytes(buffer);
+    ASSERT_TRUE(view);
+    ASSERT_EQ(view->get_block_count(), filter.get_block_count());
+    auto copy = BloomFilter::deserialize(buffer);
+    ASSERT_TRUE(copy);
+    for(u32 index = 0; index < 1000; ++index) {
+        ASSERT_TRUE(view->contains(index * 7));
+        ASSERT_TRUE(copy->contains(index * 7));
+    }
+
+    ASSERT_FALSE(BloomFilterView::from_bytes({buffer.get_data() + 1, buffer.get_size() - 1}));
+    buffer[0] = 0;
+    ASSERT_FALSE(BloomFilter::deserialize(buffer));
+}
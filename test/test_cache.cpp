@@ -0,0 +1,131 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/cache.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kstd;
+
+TEST(kstd_LruCache, test_put_get_evict) {
+    LruCache<i32, std::string> cache {3};
+    ASSERT_FALSE(cache.put(1, "one"));
+    ASSERT_FALSE(cache.put(2, "two"));
+    ASSERT_FALSE(cache.put(3, "three"));
+    ASSERT_EQ(cache.get_size(), 3);
+
+    // Touch 1, so 2 becomes the least recently used entry
+    ASSERT_EQ(*cache.get(1), "one");
+    auto evicted = cache.put(4, "four");
+    ASSERT_TRUE(evicted);
+    ASSERT_EQ(evicted->first, 2);
+    ASSERT_EQ(evicted->second, "two");
+    ASSERT_FALSE(cache.get(2));
+
+    *cache.get(3) = "drei";
+    ASSERT_EQ(*cache.peek(3), "drei");
+    ASSERT_FALSE(cache.put(3, "three"));
+    ASSERT_EQ(*cache.erase(3), "three");
+    ASSERT_FALSE(cache.contains(3));
+    ASSERT_FALSE(cache.put(5, "five"));
+
+    std::vector<i32> order {};
+    cache.for_each([&](const i32& key, const std::string&) {
+        order.push_back(key);
+    });
+    ASSERT_EQ(order, (std::vector<i32> {5, 4, 1}));
+
+    const auto stats = cache.get_stats();
+    ASSERT_EQ(stats.hits, 2);
+    ASSERT_EQ(stats.misses, 1);
+    ASSERT_EQ(stats.evictions, 1);
+
+    cache.clear();
+    ASSERT_TRUE(cache.is_empty());
+    for(i32 index = 0; index < 100; ++index) {
+        cache.put(index, std::to_string(index));
+    }
+    ASSERT_EQ(cache.get_size(), 3);
+    ASSERT_TRUE(cache.contains(97));
+    ASSERT_TRUE(cache.contains(99));
+}
+
+TEST(kstd_ClockCache, test_scan_resistance) {
+    ClockCache<i32, i32> cache {4};
+    for(i32 index = 0; index < 4; ++index) {
+        cache.put(index, index * 10);
+    }
+    // Keys 0 and 1 are hot
+    ASSERT_EQ(*cache.get(0), 0);
+    ASSERT_EQ(*cache.get(1), 10);
+
+    // A scan over more cold keys than the cache can hold must not displace the hot ones
+    for(i32 index = 100; index < 112; ++index) {
+        const auto evicted = cache.put(index, index);
+        ASSERT_TRUE(evicted);
+        ASSERT_NE(evicted->first, 0);
+        ASSERT_NE(evicted->first, 1);
+    }
+    ASSERT_TRUE(cache.contains(0));
+    ASSERT_TRUE(cache.contains(1));
+    ASSERT_FALSE(cache.contains(2));
+    ASSERT_FALSE(cache.contains(3));
+    ASSERT_TRUE(cache.contains(111));
+    ASSERT_EQ(cache.get_stats().evictions, 12);
+
+    ASSERT_EQ(*cache.erase(111), 111);
+    ASSERT_FALSE(cache.put(5, 50));
+    ASSERT_EQ(cache.get_size(), 4);
+
+    std::vector<i32> order {};
+    cache.for_each([&](const i32& key, const i32&) {
+        order.push_back(key);
+    });
+    ASSERT_EQ(order, (std::vector<i32> {5, 110, 1, 0}));
+}
+
+TEST(kstd_ShardedCache, test_concurrent_access) {
+    ShardedCache<LruCache<u64, u64>> cache {1024, 8};
+    ASSERT_EQ(cache.get_shard_count(), 8);
+
+    std::vector<std::thread> threads {};
+    for(u64 thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&cache, thread] {
+            for(u64 index = 0; index < 10'000; ++index) {
+                const auto key = (thread << 32) | (index % 200);
+                if(auto value = cache.get(key)) {
+                    ASSERT_EQ(*value, key * 2);
+                }
+                else {
+                    cache.put(key, key * 2);
+                }
+            }
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto stats = cache.get_stats();
+    ASSERT_EQ(stats.get_lookups(), 40'000);
+    ASSERT_GT(stats.get_hit_ratio(), 0.5);
+    ASSERT_LE(cache.get_size(), 1024);
+}
@@ -0,0 +1,184 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/codec.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace kstd;
+
+namespace {
+    auto to_bytes(std::string_view value) -> std::vector<u8> {
+        return {value.begin(), value.end()};
+    }
+
+    auto bytes_of(const std::vector<u8>& value) -> Slice<const u8> {
+        return {value.data(), value.size()};
+    }
+
+    auto chars_of(std::string_view value) -> Slice<const char> {
+        return {value.data(), value.size()};
+    }
+
+    auto encode_base64(const std::vector<u8>& value, base64::Alphabet alphabet = base64::Alphabet::STANDARD)
+            -> std::string {
+        std::string result(base64::get_encoded_size(value.size(), alphabet), '\0');
+        const auto count = base64::encode(bytes_of(value), {result.data(), result.size()}, alphabet);
+        EXPECT_TRUE(count);
+        EXPECT_EQ(*count, result.size());
+        return result;
+    }
+
+    auto decode_base64(std::string_view value, base64::Alphabet alphabet = base64::Alphabet::STANDARD)
+            -> Result<std::vector<u8>, DecodeError> {
+        const auto size = base64::get_decoded_size(chars_of(value));
+        if(!size) {
+            return size.forward<std::vector<u8>>();
+        }
+        std::vector<u8> result(*size);
+        const auto count = base64::decode(chars_of(value), {result.data(), result.size()}, alphabet);
+        if(!count) {
+            return count.forward<std::vector<u8>>();
+        }
+        EXPECT_EQ(*count, result.size());
+        return result;
+    }
+
+    auto random_bytes(usize count) -> std::vector<u8> {
+        std::vector<u8> result(count);
+        u32 state = 0x12345678;
+        for(auto& value : result) {
+            state = state * 1664525 + 1013904223;
+            value = static_cast<u8>(state >> 24);
+        }
+        return result;
+    }
+}// namespace
+
+TEST(kstd_codec, test_base64_encode) {
+    ASSERT_EQ(encode_base64(to_bytes("")), "");
+    ASSERT_EQ(encode_base64(to_bytes("f")), "Zg==");
+    ASSERT_EQ(encode_base64(to_bytes("fo")), "Zm8=");
+    ASSERT_EQ(encode_base64(to_bytes("foo")), "Zm9v");
+    ASSERT_EQ(encode_base64(to_bytes("foob")), "Zm9vYg==");
+    ASSERT_EQ(encode_base64(to_bytes("fooba")), "Zm9vYmE=");
+    ASSERT_EQ(encode_base64(to_bytes("foobar")), "Zm9vYmFy");
+    ASSERT_EQ(encode_base64({0xFB, 0xFF, 0xBF}), "+/+/");
+    ASSERT_EQ(encode_base64({0xFB, 0xFF, 0xBF, 0xFF}, base64::Alphabet::URL), "-_-__w");
+}
+
+TEST(kstd_codec, test_base64_decode) {
+    ASSERT_EQ(*decode_base64("Zm9vYmE="), to_bytes("fooba"));
+    ASSERT_EQ(*decode_base64("Zm9vYmE"), to_bytes("fooba"));
+    ASSERT_EQ(*decode_base64("Zg=="), to_bytes("f"));
+    ASSERT_EQ(*decode_base64(""), to_bytes(""));
+    ASSERT_EQ(*decode_base64("-_-__w", base64::Alphabet::URL), std::vector<u8>({0xFB, 0xFF, 0xBF, 0xFF}));
+    ASSERT_EQ(*decode_base64("-_-__w==", base64::Alphabet::URL), std::vector<u8>({0xFB, 0xFF, 0xBF, 0xFF}));
+}
+
+TEST(kstd_codec, test_base64_errors) {
+    auto result = decode_base64("Zm9v*mFy");
+    ASSERT_TRUE(result.is_error());
+    ASSERT_EQ(result.get_error().get_kind(), DecodeErrorKind::INVALID_CHARACTER);
+    ASSERT_EQ(result.get_error().get_offset(), 4);
+
+    result = decode_base64("-_-__w");
+    ASSERT_EQ(result.get_error().get_kind(), DecodeErrorKind::INVALID_CHARACTER);
+    ASSERT_EQ(result.get_error().get_offset(), 0);
+
+    result = decode_base64("Zm9vY");
+    ASSERT_EQ(result.get_error().get_kind(), DecodeErrorKind::INVALID_LENGTH);
+    ASSERT_EQ(result.get_error().get_offset(), 5);
+
+    result = decode_base64("Zm9=");
+    ASSERT_EQ(result.get_error().get_kind(), DecodeErrorKind::INVALID_CHARACTER);
+    ASSERT_EQ(result.get_error().get_offset(), 2);
+
+    result = decode_base64("Zm=v");
+    ASSERT_EQ(result.get_error().get_kind(), DecodeErrorKind::INVALID_PADDING);
+    ASSERT_EQ(result.get_error().get_offset(), 2);
+
+    result = decode_base64("Zm9vYg=");
+    ASSERT_EQ(result.get_error().get_kind(), DecodeErrorKind::INVALID_PADDING);
+    ASSERT_EQ(result.get_error().get_offset(), 6);
+
+    result = decode_base64("Zh==");// Trailing bits are not zero
+    ASSERT_EQ(result.get_error().get_kind(), DecodeErrorKind::INVALID_CHARACTER);
+    ASSERT_EQ(result.get_error().get_offset(), 1);
+
+    std::array<u8, 2> buffer {};
+    const auto small = base64::decode(chars_of("Zm9v"), {buffer.data(), buffer.size()});
+    ASSERT_EQ(small.get_error().get_kind(), DecodeErrorKind::BUFFER_TOO_SMALL);
+    ASSERT_EQ(small.get_error().get_offset(), 3);
+
+    std::array<char, 3> out {};
+    ASSERT_TRUE(base64::encode(bytes_of(to_bytes("foo")), {out.data(), out.size()}).is_error());
+}
+
+TEST(kstd_codec, test_base64_round_trip) {
+    for(const auto alphabet : {base64::Alphabet::STANDARD, base64::Alphabet::URL}) {
+        for(usize size = 0; size < 300; size += 7) {
+            const auto value = random_bytes(size);
+            const auto encoded = encode_base64(value, alphabet);
+            ASSERT_EQ(*decode_base64(encoded, alphabet), value);
+        }
+    }
+}
+
+TEST(kstd_codec, test_base64_error_in_long_input) {
+    auto encoded = encode_base64(random_bytes(300));
+    encoded[200] = '.';
+    const auto result = decode_base64(encoded);
+    ASSERT_EQ(result.get_error().get_kind(), DecodeErrorKind::INVALID_CHARACTER);
+    ASSERT_EQ(result.get_error().get_offset(), 200);
+}
+
+TEST(kstd_codec, test_hex) {
+    const auto value = to_bytes("\x01\xAB\xFF kstd");
+    std::string encoded(hex::get_encoded_size(value.size()), '\0');
+    ASSERT_EQ(*hex::encode(bytes_of(value), {encoded.data(), encoded.size()}), encoded.size());
+    ASSERT_EQ(encoded, "01abff206b737464");
+    ASSERT_TRUE(hex::encode(bytes_of(value), {encoded.data(), encoded.size()}, hex::Case::UPPER));
+    ASSERT_EQ(encoded, "01ABFF206B737464");
+
+    std::vector<u8> decoded(*hex::get_decoded_size(chars_of(encoded)));
+    ASSERT_EQ(*hex::decode(chars_of("01abFF206b737464"), {decoded.data(), decoded.size()}), value.size());
+    ASSERT_EQ(decoded, value);
+}
+
+TEST(kstd_codec, test_hex_round_trip_and_errors) {
+    const auto value = random_bytes(200);
+    std::string encoded(hex::get_encoded_size(value.size()), '\0');
+    ASSERT_TRUE(hex::encode(bytes_of(value), {encoded.data(), encoded.size()}));
+    std::vector<u8> decoded(value.size());
+    ASSERT_TRUE(hex::decode(chars_of(encoded), {decoded.data(), decoded.size()}));
+    ASSERT_EQ(decoded, value);
+
+    encoded[101] = 'g';
+    auto result = hex::decode(chars_of(encoded), {decoded.data(), decoded.size()});
+    ASSERT_EQ(result.get_error().get_kind(), DecodeErrorKind::INVALID_CHARACTER);
+    ASSERT_EQ(result.get_error().get_offset(), 101);
+
+    result = hex::decode(chars_of("abc"), {decoded.data(), decoded.size()});
+    ASSERT_EQ(result.get_error().get_kind(), DecodeErrorKind::INVALID_LENGTH);
+    ASSERT_EQ(result.get_error().get_offset(), 3);
+    ASSERT_EQ(result.get_error().to_string(), "Invalid input length 3");
+}
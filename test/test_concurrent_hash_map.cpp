@@ -0,0 +1,111 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/concurrent_hash_map.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kstd;
+
+TEST(kstd_ConcurrentHashMap, test_insert_find_erase) {
+    ConcurrentHashMap<i32, std::string> map {4};
+    ASSERT_EQ(map.get_shard_count(), 4);
+    ASSERT_TRUE(map.is_empty());
+
+    for(i32 index = 0; index < 1000; ++index) {
+        ASSERT_TRUE(map.insert(index, std::to_string(index)));
+    }
+    ASSERT_FALSE(map.insert(5, "five"));
+    ASSERT_EQ(map.get_size(), 1000);
+    ASSERT_EQ(*map.find(5), "5");
+    ASSERT_FALSE(map.find(1000));
+
+    ASSERT_FALSE(map.insert_or_assign(5, "five"));
+    ASSERT_EQ(*map.find(5), "five");
+    ASSERT_TRUE(map.update(6, [](std::string& value) {
+        value += "!";
+    }));
+    ASSERT_EQ(*map.find(6), "6!");
+
+    for(i32 index = 0; index < 1000; index += 2) {
+        ASSERT_TRUE(map.erase(index));
+    }
+    ASSERT_FALSE(map.erase(0));
+    ASSERT_EQ(map.get_size(), 500);
+    for(i32 index = 1; index < 1000; index += 2) {
+        ASSERT_TRUE(map.contains(index));
+        ASSERT_FALSE(map.contains(index - 1));
+    }
+
+    usize count = 0;
+    map.for_each([&](const i32& key, const std::string&) {
+        ASSERT_EQ(key % 2, 1);
+        ++count;
+    });
+    ASSERT_EQ(count, 500);
+
+    map.clear();
+    ASSERT_TRUE(map.is_empty());
+    ASSERT_EQ(map.get_or_insert_with(42, [] { return std::string {"answer"}; }), "answer");
+    ASSERT_EQ(map.get_or_insert_with(42, [] { return std::string {"other"}; }), "answer");
+}
+
+TEST(kstd_ConcurrentHashMap, test_concurrent_access) {
+    ConcurrentHashMap<u64, u64> map {};
+    constexpr u64 per_thread = 20'000;
+    static constexpr u64 counter = ~u64 {0};
+    ASSERT_TRUE(map.insert(counter, 0));
+    std::vector<std::thread> threads {};
+    for(u64 thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&map, thread] {
+            const auto base = thread * per_thread;
+            for(u64 index = 0; index < per_thread; ++index) {
+                ASSERT_TRUE(map.insert(base + index, (base + index) * 2));
+                ASSERT_EQ(*map.find(base + index), (base + index) * 2);
+                ASSERT_TRUE(map.update(base + index, [](u64& value) {
+                    value += 1;
+                }));
+                ASSERT_EQ(*map.find(base + index), (base + index) * 2 + 1);
+                ASSERT_TRUE(map.update(counter, [](u64& value) {
+                    ++value;
+                }));
+            }
+            for(u64 index = 0; index < per_thread; index += 2) {
+                ASSERT_TRUE(map.erase(base + index));
+            }
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(*map.find(counter), 4 * per_thread);
+    ASSERT_FALSE(map.update(4 * per_thread, [](u64& value) {
+        ++value;
+    }));
+    ASSERT_EQ(map.get_size(), 2 * per_thread + 1);
+    for(u64 index = 0; index < 4 * per_thread; ++index) {
+        ASSERT_EQ(map.contains(index), index % 2 == 1);
+        if(index % 2 == 1) {
+            ASSERT_EQ(*map.find(index), index * 2 + 1);
+        }
+    }
+}
@@ -0,0 +1,156 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/epoch.hpp>
+#include <kstd/libc.hpp>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace kstd;
+
+namespace {
+    struct Node final {
+        static inline atomic_usize destroyed {0};
+        u64 magic = 0xC0FFEE;
+        usize value = 0;
+
+        explicit Node(usize value) noexcept :
+                value {value} {
+        }
+
+        ~Node() noexcept {
+            magic = 0;
+            destroyed.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    struct CountingDeleter final {
+        usize* count;
+
+        auto operator()(Node* node) const noexcept -> void {
+            ++*count;
+            delete node;// NOLINT
+        }
+    };
+}// namespace
+
+TEST(kstd_Epoch, test_retire_unpinned) {
+    Epoch epoch {4};
+    Node::destroyed = 0;
+    for(usize index = 0; index < 16; ++index) {
+        epoch.retire(new Node(index));// NOLINT
+    }
+    while(epoch.get_pending_count() > 0) {
+        epoch.collect();
+    }
+    ASSERT_EQ(Node::destroyed.load(), 16);
+}
+
+TEST(kstd_Epoch, test_pinned_blocks_reclamation) {
+    Epoch epoch {1};
+    Node::destroyed = 0;
+    usize deleted = 0;
+    std::atomic<Node*> shared {new Node(1)};// NOLINT
+
+    auto guard = epoch.pin();
+    auto* node = shared.load();
+
+    std::thread writer([&] {
+        epoch.retire(shared.exchange(new Node(2)), CountingDeleter {&deleted});// NOLINT
+        for(usize index = 0; index < 10; ++index) {
+            epoch.collect();
+        }
+    });
+    writer.join();
+
+    ASSERT_EQ(deleted, 0);// Still protected by our guard
+    ASSERT_EQ(node->magic, 0xC0FFEE);
+    guard.release();
+
+    // The record of the exited writer is recycled by the next thread, including its pending objects
+    std::thread collector([&] {
+        while(epoch.get_pending_count() > 0) {
+            epoch.collect();
+        }
+    });
+    collector.join();
+    ASSERT_EQ(deleted, 1);
+    delete shared.exchange(nullptr);// NOLINT
+}
+
+TEST(kstd_Epoch, test_retired_move_only) {
+    static_assert(!std::is_copy_constructible_v<Retired>);
+    static_assert(!std::is_copy_assignable_v<Retired>);
+
+    usize count = 0;
+    auto retired = Retired::make(new Node(0), CountingDeleter {&count});// NOLINT
+    auto moved = std::move(retired);
+    retired.reclaim();// Moved-from, must not touch the node
+    ASSERT_EQ(count, 0);
+    moved.reclaim();
+    moved.reclaim();
+    ASSERT_EQ(count, 1);
+}
+
+TEST(kstd_Epoch, test_free_deleter) {
+    Epoch epoch {1};
+    for(usize index = 0; index < 8; ++index) {
+        epoch.retire(static_cast<u64*>(libc::malloc(sizeof(u64))), libc::FreeDeleter {});// NOLINT
+    }
+    while(epoch.get_pending_count() > 0) {
+        epoch.collect();
+    }
+    ASSERT_EQ(epoch.get_pending_count(), 0);
+}
+
+TEST(kstd_Epoch, test_concurrent_readers) {
+    Node::destroyed = 0;
+    {
+        Epoch epoch {8};
+        std::atomic<Node*> shared {new Node(0)};// NOLINT
+        std::atomic_bool running {true};
+        atomic_usize errors {0};
+
+        std::vector<std::thread> readers {};
+        for(usize index = 0; index < 3; ++index) {
+            readers.emplace_back([&] {
+                while(running.load(std::memory_order_relaxed)) {
+                    const auto guard = epoch.pin();
+                    const auto* node = shared.load(std::memory_order_acquire);
+                    if(node->magic != 0xC0FFEE) {
+                        errors.fetch_add(1);
+                    }
+                }
+            });
+        }
+
+        for(usize index = 1; index <= 2000; ++index) {
+            auto* previous = shared.exchange(new Node(index), std::memory_order_acq_rel);// NOLINT
+            epoch.retire(previous);
+        }
+        running = false;
+        for(auto& reader : readers) {
+            reader.join();
+        }
+        ASSERT_EQ(errors.load(), 0);
+        epoch.retire(shared.exchange(nullptr));
+    }
+}
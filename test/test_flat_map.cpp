@@ -0,0 +1,146 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/flat_map.hpp>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace kstd;
+
+TEST(kstd_FlatMap, test_bulk_construction) {
+    const std::vector<std::pair<i32, std::string>> entries {{3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}};
+    const FlatMap<i32, std::string> map {
+            Slice<const std::pair<i32, std::string>> {entries.data(), entries.size() * sizeof(entries[0])}};
+    ASSERT_EQ(map.get_size(), 3);
+    ASSERT_EQ(*map.find(1), "one");
+    ASSERT_EQ(*map.find(2), "two");
+    ASSERT_EQ(*map.find(3), "three");
+    ASSERT_FALSE(map.find(4));
+
+    const auto keys = map.get_keys();
+    ASSERT_EQ(keys.get_count(), 3);
+    ASSERT_EQ(keys[0], 1);
+    ASSERT_EQ(keys[2], 3);
+}
+
+TEST(kstd_FlatMap, test_insert_erase) {
+    FlatMap<std::string, i32> map {{"b", 2}, {"a", 1}};
+    ASSERT_TRUE(map.insert("c", 3));
+    ASSERT_FALSE(map.insert("a", 10));
+    ASSERT_EQ(*map.find("a"), 1);
+    ASSERT_FALSE(*map.insert_or_assign("a", 10));
+    ASSERT_EQ(*map.find("a"), 10);
+
+    auto value = map.find("b");
+    ASSERT_TRUE(value);
+    *value = 20;
+    ASSERT_EQ(*map.find("b"), 20);
+
+    ASSERT_EQ(*map.erase("b"), 20);
+    ASSERT_FALSE(map.erase("b"));
+    ASSERT_FALSE(map.contains("b"));
+    ASSERT_EQ(map.get_size(), 2);
+
+    std::string joined {};
+    map.for_each([&joined](const std::string& key, i32& value) {
+        joined += key;
+        value += 1;
+    });
+    ASSERT_EQ(joined, "ac");
+    ASSERT_EQ(*map.find("c"), 4);
+}
+
+TEST(kstd_FlatMap, test_against_std_map) {
+    std::mt19937 random {1};
+    FlatMap<u32, u32> map {};
+    std::map<u32, u32> expected {};
+    for(usize index = 0; index < 20000; ++index) {
+        const auto key = static_cast<u32>(random() % 2000);
+        switch(random() % 3) {
+            case 0:
+                ASSERT_EQ(map.insert(key, static_cast<u32>(index)), expected.emplace(key, index).second);
+                break;
+            case 1:
+                ASSERT_EQ(map.erase(key).has_value(), expected.erase(key) == 1);
+                break;
+            default: {
+                const auto iterator = expected.find(key);
+                const auto value = map.find(key);
+                ASSERT_EQ(value.has_value(), iterator != expected.end());
+                if(value) {
+                    ASSERT_EQ(*value, iterator->second);
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(map.get_size(), expected.size());
+    }
+    for(u32 key = 0; key < 2001; ++key) {
+        const auto bound = static_cast<usize>(std::distance(expected.begin(), expected.lower_bound(key)));
+        ASSERT_EQ(map.lower_bound(key), bound);
+    }
+}
+
+TEST(kstd_StaticFlatMap, test_inline_storage) {
+    StaticFlatMap<u32, std::string, 8> map {{5, "five"}, {2, "two"}, {5, "cinco"}, {7, "seven"}};
+    ASSERT_EQ(map.get_capacity(), 8);
+    ASSERT_EQ(map.get_size(), 3);
+    ASSERT_EQ(*map.find(5), "five");
+    ASSERT_TRUE(map.insert(1, "one"));
+    ASSERT_EQ(map.lower_bound(3), 2);
+    ASSERT_EQ(*map.erase(2), "two");
+    ASSERT_EQ(map.get_size(), 3);
+
+    const auto& view = map;
+    const auto values = view.get_values();
+    ASSERT_EQ(values.get_count(), 3);
+    ASSERT_EQ(values[0], "one");
+    ASSERT_EQ(values[1], "five");
+    ASSERT_EQ(values[2], "seven");
+}
+
+TEST(kstd_StaticFlatMap, test_duplicates_and_full) {
+    // Four entries, but only two distinct keys which fit
+    StaticFlatMap<i32, i32, 2> map {{1, 1}, {1, 2}, {2, 3}, {2, 4}};
+    ASSERT_EQ(map.get_size(), 2);
+    ASSERT_EQ(*map.find(1), 1);
+    ASSERT_EQ(*map.find(2), 3);
+
+    ASSERT_FALSE(map.insert(3, 5));
+    ASSERT_FALSE(map.contains(3));
+    ASSERT_TRUE(map.insert_or_assign(3, 5).is_error());
+    ASSERT_FALSE(*map.insert_or_assign(2, 6));
+    ASSERT_EQ(*map.find(2), 6);
+    ASSERT_EQ(map.get_size(), 2);
+
+    ASSERT_EQ(*map.erase(1), 1);
+    ASSERT_TRUE(*map.insert_or_assign(3, 5));
+    ASSERT_EQ(map.get_keys()[1], 3);
+}
+
+TEST(kstd_StaticFlatMap, test_empty) {
+    const StaticFlatMap<i32, i32, 4> map {};
+    ASSERT_TRUE(map.is_empty());
+    ASSERT_EQ(map.lower_bound(0), 0);
+    ASSERT_FALSE(map.find(0));
+}
@@ -0,0 +1,123 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <array>
+#include <deque>
+#include <gtest/gtest.h>
+#include <kstd/function.hpp>
+#include <memory>
+#include <string>
+
+using namespace kstd;
+
+namespace {
+    struct Counter final {
+        usize* destroyed;
+        std::array<u64, 8> padding;
+
+        explicit Counter(usize* destroyed) noexcept :
+                destroyed {destroyed},
+                padding {} {
+        }
+
+        Counter(Counter&& other) noexcept :
+                destroyed {std::exchange(other.destroyed, nullptr)},
+                padding {other.padding} {
+        }
+
+        ~Counter() noexcept {
+            if(destroyed != nullptr) {
+                ++*destroyed;
+            }
+        }
+
+        auto operator()() const noexcept -> usize {
+            return padding.size();
+        }
+    };
+}// namespace
+
+TEST(kstd_Function, test_inline) {
+    i32 base = 40;
+    Function<i32(i32)> function {[base](i32 value) {
+        return base + value;
+    }};
+    ASSERT_TRUE(function);
+    ASSERT_EQ(function(2), 42);
+    ASSERT_TRUE((Function<i32(i32)>::stores_inline<i32 (*)(i32)>()));
+
+    auto moved = std::move(function);
+    ASSERT_FALSE(function);
+    ASSERT_EQ(moved(3), 43);
+
+    moved = nullptr;
+    ASSERT_TRUE(moved.is_empty());
+}
+
+TEST(kstd_Function, test_move_only) {
+    auto value = std::make_unique<std::string>("task");
+    Function<std::string()> function {[value = std::move(value)] {
+        return *value + "!";
+    }};
+    ASSERT_EQ(function(), "task!");
+
+    Function<std::string()> other {};
+    other = std::move(function);
+    ASSERT_EQ(other(), "task!");
+
+    Function<void(std::unique_ptr<i32>&&)> consumer {[](std::unique_ptr<i32>&& pointer) {
+        ASSERT_EQ(*pointer, 5);
+    }};
+    consumer(std::make_unique<i32>(5));
+}
+
+TEST(kstd_Function, test_heap_and_destruction) {
+    usize destroyed = 0;
+    {
+        ASSERT_FALSE(Function<usize()>::stores_inline<Counter>());
+        ASSERT_TRUE((Function<usize(), sizeof(Counter)>::stores_inline<Counter>()));
+
+        Function<usize()> heap {Counter {&destroyed}};
+        Function<usize(), sizeof(Counter)> inline_function {Counter {&destroyed}};
+        ASSERT_EQ(heap(), 8);
+        ASSERT_EQ(inline_function(), 8);
+
+        auto moved_heap = std::move(heap);
+        auto moved_inline = std::move(inline_function);
+        ASSERT_EQ(moved_heap(), 8);
+        ASSERT_EQ(moved_inline(), 8);
+        ASSERT_EQ(destroyed, 0);
+    }
+    ASSERT_EQ(destroyed, 2);
+}
+
+TEST(kstd_Function, test_queue) {
+    std::deque<Function<void(usize&)>> queue {};
+    for(usize index = 0; index < 100; ++index) {
+        queue.emplace_back([index](usize& sum) {
+            sum += index;
+        });
+    }
+    usize sum = 0;
+    while(!queue.empty()) {
+        queue.front()(sum);
+        queue.pop_front();
+    }
+    ASSERT_EQ(sum, 4950);
+}
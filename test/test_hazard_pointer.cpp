@@ -0,0 +1,131 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/hazard_pointer.hpp>
+#include <thread>
+#include <vector>
+
+using namespace kstd;
+
+namespace {
+    struct Node final {
+        static inline atomic_usize destroyed {0};
+        u64 magic = 0xC0FFEE;
+        usize value = 0;
+
+        explicit Node(usize value) noexcept :
+                value {value} {
+        }
+
+        ~Node() noexcept {
+            magic = 0;
+            destroyed.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    auto find(HazardPointer& hazard, const std::atomic<Node*>& head) noexcept -> Option<Node*> {
+        return hazard.protect_option(head);
+    }
+}// namespace
+
+TEST(kstd_HazardPointer, test_protect) {
+    HazardDomain domain {1};
+    Node::destroyed = 0;
+    std::atomic<Node*> shared {new Node(1)};// NOLINT
+
+    HazardPointer hazard {domain};
+    auto result = find(hazard, shared);
+    ASSERT_TRUE(result);
+    ASSERT_EQ((*result)->value, 1);
+
+    std::thread writer([&] {
+        domain.retire(shared.exchange(nullptr));
+        domain.collect();
+        ASSERT_EQ(domain.get_pending_count(), 1);// Still protected by the hazard pointer
+    });
+    writer.join();
+    ASSERT_EQ(Node::destroyed.load(), 0);
+    ASSERT_EQ((*result)->magic, 0xC0FFEE);
+
+    hazard.reset_protection();
+    ASSERT_FALSE(find(hazard, shared));
+
+    std::thread collector([&] {
+        domain.collect();// Picks up the retire list of the exited writer
+    });
+    collector.join();
+    ASSERT_EQ(Node::destroyed.load(), 1);
+}
+
+TEST(kstd_HazardPointer, test_bounded_with_blocked_reader) {
+    HazardDomain domain {8};
+    Node::destroyed = 0;
+    std::atomic<Node*> shared {new Node(0)};// NOLINT
+
+    HazardPointer hazard {domain};
+    auto* protected_node = hazard.protect(shared);
+
+    for(usize index = 1; index <= 1000; ++index) {
+        domain.retire(shared.exchange(new Node(index)));// NOLINT
+    }
+    domain.collect();
+    ASSERT_EQ(domain.get_pending_count(), 1);// Only the object held by the blocked reader
+    ASSERT_EQ(protected_node->magic, 0xC0FFEE);
+
+    hazard.release();
+    domain.collect();
+    ASSERT_EQ(domain.get_pending_count(), 0);
+    ASSERT_EQ(Node::destroyed.load(), 1000);
+    delete shared.exchange(nullptr);// NOLINT
+}
+
+TEST(kstd_HazardPointer, test_concurrent_readers) {
+    Node::destroyed = 0;
+    HazardDomain domain {16};
+    std::atomic<Node*> shared {new Node(0)};// NOLINT
+    std::atomic_bool running {true};
+    atomic_usize errors {0};
+
+    std::vector<std::thread> readers {};
+    for(usize index = 0; index < 3; ++index) {
+        readers.emplace_back([&] {
+            HazardPointer hazard {domain};
+            while(running.load(std::memory_order_relaxed)) {
+                const auto* node = hazard.protect(shared);
+                if(node->magic != 0xC0FFEE) {
+                    errors.fetch_add(1);
+                }
+                hazard.reset_protection();
+            }
+        });
+    }
+
+    for(usize index = 1; index <= 2000; ++index) {
+        domain.retire(shared.exchange(new Node(index), std::memory_order_acq_rel));// NOLINT
+    }
+    running = false;
+    for(auto& reader : readers) {
+        reader.join();
+    }
+    ASSERT_EQ(errors.load(), 0);
+    domain.collect();
+    ASSERT_EQ(domain.get_pending_count(), 0);
+    delete shared.exchange(nullptr);// NOLINT
+}
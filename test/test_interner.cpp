@@ -0,0 +1,90 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/interner.hpp>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace kstd;
+
+TEST(kstd_Symbol, test_layout) {
+    static_assert(sizeof(Symbol) == sizeof(u32));
+    static_assert(sizeof(Option<Symbol>) == sizeof(u32));
+    static_assert(std::is_trivially_copyable_v<Symbol>);
+
+    Option<Symbol> symbol {};
+    ASSERT_FALSE(symbol);
+    symbol = Symbol {3};
+    ASSERT_TRUE(symbol);
+    ASSERT_EQ(symbol->get_id(), 3);
+    ASSERT_EQ(std::hash<Symbol> {}(Symbol {3}), std::hash<Symbol> {}(*symbol));
+}
+
+TEST(kstd_Interner, test_intern_resolve) {
+    Interner interner {4};
+    const auto first = interner.intern("service.latency");
+    const auto second = interner.intern("service.errors");
+    ASSERT_NE(first, second);
+    ASSERT_EQ(interner.intern(std::string {"service."} + "latency"), first);
+    ASSERT_EQ(interner.get_size(), 2);
+
+    ASSERT_EQ(interner.resolve(first), "service.latency");
+    ASSERT_EQ(interner.resolve(second).data()[interner.resolve(second).size()], '\0');
+    ASSERT_EQ(*interner.find("service.errors"), second);
+    ASSERT_FALSE(interner.find("service.unknown"));
+
+    const std::string large(10'000, 'x');
+    ASSERT_EQ(interner.resolve(interner.intern(large)), large);
+    ASSERT_EQ(interner.intern(""), interner.intern(""));
+
+    std::unordered_map<Symbol, usize> counts {};
+    ++counts[first];
+    ++counts[interner.intern("service.latency")];
+    ASSERT_EQ(counts[first], 2);
+}
+
+TEST(kstd_Interner, test_concurrent_intern) {
+    Interner interner {};
+    constexpr usize count = 5'000;
+    std::vector<std::vector<Symbol>> results(4);
+    std::vector<std::thread> threads {};
+    for(usize thread = 0; thread < results.size(); ++thread) {
+        threads.emplace_back([&interner, &results, thread] {
+            for(usize index = 0; index < count; ++index) {
+                // Every thread interns the same strings, in a different order
+                const auto value = (index * (thread + 1) * 7919) % count;
+                results[thread].push_back(interner.intern("tag" + std::to_string(value)));
+            }
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(interner.get_size(), count);
+    for(usize thread = 0; thread < results.size(); ++thread) {
+        for(usize index = 0; index < count; ++index) {
+            const auto value = (index * (thread + 1) * 7919) % count;
+            ASSERT_EQ(interner.resolve(results[thread][index]), "tag" + std::to_string(value));
+        }
+    }
+}
@@ -0,0 +1,146 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+#include <kstd/iter.hpp>
+#include <vector>
+
+TEST(kstd_iter, test_from_slice) {
+    using namespace kstd;
+    std::array<i32, 4> values {1, 2, 3, 4};
+    Slice<i32> slice {values.data(), values.size() * sizeof(i32)};
+    auto iterator = iter::from(slice);
+    auto first = iterator.next();
+    ASSERT_TRUE(first);
+    ASSERT_EQ(*first, 1);
+    *first = 10;
+    ASSERT_EQ(values[0], 10);
+    ASSERT_EQ(iter::from(slice).count(), 4);
+}
+
+TEST(kstd_iter, test_map_filter) {
+    using namespace kstd;
+    std::vector<i32> values {1, 2, 3, 4, 5, 6};
+    auto result = iter::from(values)
+                          .filter([](const i32& value) {
+                              return value % 2 == 0;
+                          })
+                          .map([](const i32& value) {
+                              return value * 10;
+                          })
+                          .collect();
+    ASSERT_EQ(result, (std::vector<i32> {20, 40, 60}));
+}
+
+TEST(kstd_iter, test_zip_enumerate) {
+    using namespace kstd;
+    std::array<i32, 3> first {1, 2, 3};
+    std::array<char, 2> second {'a', 'b'};
+    auto zipped = iter::from(first).zip(iter::from(second));
+    ASSERT_EQ(zipped.count(), 2);
+    auto pair = zipped.next();
+    ASSERT_TRUE(pair);
+    ASSERT_EQ(pair->first, 1);
+    ASSERT_EQ(pair->second, 'a');
+
+    auto enumerated = iter::from(second).enumerate();
+    auto item = enumerated.next();
+    item = enumerated.next();
+    ASSERT_TRUE(item);
+    ASSERT_EQ(item->first, 1);
+    ASSERT_EQ(item->second, 'b');
+    ASSERT_FALSE(enumerated.next());
+}
+
+TEST(kstd_iter, test_take_skip) {
+    using namespace kstd;
+    auto result = iter::range<i32>(0, 10).skip(3).take(4).collect();
+    ASSERT_EQ(result, (std::vector<i32> {3, 4, 5, 6}));
+    ASSERT_EQ(iter::range<i32>(0, 3).skip(5).count(), 0);
+    ASSERT_EQ(iter::range<i32>(0, 3).take(5).count(), 3);
+}
+
+TEST(kstd_iter, test_chunks) {
+    using namespace kstd;
+    std::array<i32, 5> values {1, 2, 3, 4, 5};
+    Slice<i32> slice {values.data(), values.size() * sizeof(i32)};
+    auto sizes = iter::chunks(slice, 2)
+                         .map([](Slice<i32> chunk) {
+                             return chunk.get_count();
+                         })
+                         .collect();
+    ASSERT_EQ(sizes, (std::vector<usize> {2, 2, 1}));
+}
+
+TEST(kstd_iter, test_windows) {
+    using namespace kstd;
+    std::array<i32, 5> values {1, 2, 3, 4, 5};
+    Slice<i32> slice {values.data(), values.size() * sizeof(i32)};
+    auto sums = iter::windows(slice, 3)
+                        .map([](Slice<i32> window) {
+                            return iter::from(window).fold(0, [](i32 sum, i32 value) {
+                                return sum + value;
+                            });
+                        })
+                        .collect();
+    ASSERT_EQ(sums, (std::vector<i32> {6, 9, 12}));
+    ASSERT_EQ(iter::windows(slice, 6).count(), 0);
+}
+
+TEST(kstd_iter, test_flat_map) {
+    using namespace kstd;
+    auto result = iter::range<i32>(0, 4)
+                          .flat_map([](i32 value) {
+                              return iter::range<i32>(0, value);
+                          })
+                          .collect();
+    ASSERT_EQ(result, (std::vector<i32> {0, 0, 1, 0, 1, 2}));
+}
+
+TEST(kstd_iter, test_find_any_all) {
+    using namespace kstd;
+    std::vector<i32> values {1, 3, 5, 6};
+    auto found = iter::from(values).find([](const i32& value) {
+        return value % 2 == 0;
+    });
+    ASSERT_TRUE(found);
+    ASSERT_EQ(&*found, &values[3]);
+    ASSERT_TRUE(iter::from(values).any([](const i32& value) {
+        return value > 5;
+    }));
+    ASSERT_FALSE(iter::from(values).all([](const i32& value) {
+        return value % 2 == 1;
+    }));
+}
+
+TEST(kstd_iter, test_collect_into_static_vector) {
+    using namespace kstd;
+    StaticVector<i32, 4> vector {};
+    ASSERT_EQ(iter::range<i32>(0, 3).collect_into(vector), 3);
+    ASSERT_EQ(iter::range<i32>(10, 20).collect_into(vector), 1);
+    ASSERT_EQ(vector.get_size(), 4);
+    ASSERT_EQ(vector[3], 10);
+
+    const auto& view = vector;
+    ASSERT_EQ(iter::from(view).fold(0, [](i32 sum, i32 value) {
+        return sum + value;
+    }),
+              13);
+}
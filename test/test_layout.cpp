@@ -0,0 +1,116 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/interner.hpp>
+#include <kstd/layout.hpp>
+#include <kstd/non_zero.hpp>
+#include <kstd/option.hpp>
+#include <kstd/relative_ptr.hpp>
+#include <kstd/result.hpp>
+#include <kstd/slice.hpp>
+#include <kstd/static_vector.hpp>
+#include <kstd/tuple.hpp>
+#include <string>
+
+using namespace kstd;
+
+// Budgets are upper bounds, shrinking a type is fine but growing it has to be a conscious decision
+#define KSTD_ASSERT_LAYOUT(size, alignment, ...)                                                                       \
+    static_assert(sizeof(__VA_ARGS__) <= (size));                                                                      \
+    static_assert(alignof(__VA_ARGS__) <= (alignment))
+
+TEST(kstd_Layout, test_box) {
+    KSTD_ASSERT_LAYOUT(8, 4, Box<i32>);
+    KSTD_ASSERT_LAYOUT(sizeof(void*), alignof(void*), Box<i32&>);
+    KSTD_ASSERT_LAYOUT(sizeof(std::string) + 8, alignof(std::string), Box<std::string>);
+    KSTD_ASSERT_LAYOUT(4, 4, Box<NonZero<u32>>);
+    static_assert(std::is_trivially_copyable_v<Box<i32>>);
+}
+
+TEST(kstd_Layout, test_option) {
+    KSTD_ASSERT_LAYOUT(2, 1, Option<u8>);
+    KSTD_ASSERT_LAYOUT(8, 4, Option<i32>);
+    KSTD_ASSERT_LAYOUT(16, 8, Option<u64>);
+    KSTD_ASSERT_LAYOUT(2 * sizeof(void*), alignof(void*), Option<i32*>);
+    KSTD_ASSERT_LAYOUT(sizeof(std::string) + 8, alignof(std::string), Option<std::string>);
+
+    // Niche optimized instantiations must not grow at all
+    static_assert(sizeof(Option<i32&>) == sizeof(void*));
+    static_assert(sizeof(Option<NonZero<u32>>) == sizeof(u32));
+    static_assert(sizeof(Option<Symbol>) == sizeof(u32));
+    static_assert(std::is_trivially_copyable_v<Option<i32>>);
+    static_assert(std::is_trivially_copyable_v<Option<i32&>>);
+}
+
+TEST(kstd_Layout, test_result) {
+    KSTD_ASSERT_LAYOUT(sizeof(std::string) + 8, alignof(std::string), Result<i32>);
+    KSTD_ASSERT_LAYOUT(sizeof(std::string) + 8, alignof(std::string), Result<i32&>);
+    KSTD_ASSERT_LAYOUT(sizeof(std::string) + 8, alignof(std::string), Result<void>);
+    KSTD_ASSERT_LAYOUT(12, 4, Result<i32, i32>);
+    KSTD_ASSERT_LAYOUT(24, 8, Result<u64, u8>);
+    KSTD_ASSERT_LAYOUT(2 * sizeof(void*), alignof(void*), Result<i32&, u32>);
+    KSTD_ASSERT_LAYOUT(8, 4, Result<void, i32>);
+}
+
+TEST(kstd_Layout, test_tuple) {
+    KSTD_ASSERT_LAYOUT(24, 8, Tuple<i32, i64>);
+    KSTD_ASSERT_LAYOUT(32, 8, Tuple<u8, u64, u8>);
+    static_assert(std::is_trivially_copyable_v<Tuple<i32, i64>>);
+}
+
+TEST(kstd_Layout, test_static_vector) {
+    KSTD_ASSERT_LAYOUT(8 * sizeof(i32) + sizeof(usize), alignof(usize), StaticVector<i32, 8>);
+    KSTD_ASSERT_LAYOUT(2 * sizeof(usize), alignof(usize), StaticVector<u8, 3>);
+}
+
+TEST(kstd_Layout, test_pointers) {
+    static_assert(sizeof(RelativePtr<i32>) == sizeof(u32));
+    static_assert(sizeof(RelativePtr<i32, u8>) == sizeof(u8));
+    static_assert(sizeof(RelativePtr<i32, u64>) == sizeof(u64));
+    static_assert(sizeof(NonZero<u32>) == sizeof(u32));
+    static_assert(sizeof(Slice<u8>) == 2 * sizeof(void*));
+    static_assert(std::is_trivially_copyable_v<RelativePtr<i32>>);
+    static_assert(std::is_trivially_copyable_v<Slice<u8>>);
+}
+
+TEST(kstd_Layout, test_layout_info) {
+    struct Padded final {
+        u8 flag = 0;
+        u32 value = 0;
+    };
+    const auto info = get_layout_info<Padded>("Padded");
+    ASSERT_EQ(info.name, "Padded");
+    ASSERT_EQ(info.size, 8);
+    ASSERT_EQ(info.alignment, 4);
+    ASSERT_EQ(info.padding, 0);// Opaque types report no padding
+    ASSERT_TRUE(info.is_trivially_copyable);
+    ASSERT_TRUE(info.is_trivially_destructible);
+    ASSERT_TRUE(info.is_standard_layout);
+
+    using IntResult = Result<i32, i32>;
+    using PaddedTuple = Tuple<u8, u64, u8>;
+    using SmallVector = StaticVector<u8, 3>;
+    ASSERT_EQ(get_layout_info<Option<i32>>("Option<i32>").padding, sizeof(Option<i32>) - sizeof(i32) - sizeof(u8));
+    ASSERT_EQ(get_layout_info<Option<NonZero<u32>>>("Option<NonZero<u32>>").padding, 0);
+    ASSERT_EQ(get_layout_info<Option<i32&>>("Option<i32&>").padding, 0);
+    ASSERT_EQ(get_layout_info<IntResult>("Result<i32, i32>").padding, sizeof(IntResult) - 6);
+    ASSERT_EQ(get_layout_info<PaddedTuple>("Tuple<u8, u64, u8>").padding, sizeof(PaddedTuple) - 13);
+    ASSERT_EQ(get_layout_info<SmallVector>("StaticVector<u8, 3>").padding, sizeof(usize) - 3);
+}
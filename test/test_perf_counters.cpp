@@ -0,0 +1,71 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/perf_counters.hpp>
+
+using namespace kstd;
+
+TEST(kstd_PerfCounters, test_snapshot_arithmetic) {
+    const CounterSnapshot before {{100, 200, 10, 5}, 0b1111};
+    const CounterSnapshot after {{1100, 4200, 30, 7}, 0b0111};
+    const auto delta = after - before;
+
+    ASSERT_EQ(*delta.get_cycles(), 1000);
+    ASSERT_EQ(*delta.get_instructions(), 4000);
+    ASSERT_EQ(*delta.get_cache_misses(), 20);
+    ASSERT_FALSE(delta.get_branch_misses());
+    ASSERT_EQ(*delta.get_ipc(), 4.0);
+    ASSERT_EQ(*delta.get_per_operation(PerfCounter::CACHE_MISSES, 10), 2.0);
+}
+
+TEST(kstd_PerfCounters, test_empty_snapshot) {
+    const CounterSnapshot snapshot {};
+    ASSERT_TRUE(snapshot.is_empty());
+    ASSERT_FALSE(snapshot.get_cycles());
+    ASSERT_FALSE(snapshot.get_ipc());
+}
+
+TEST(kstd_PerfCounters, test_measure) {
+    auto counters = PerfCounters::open();
+    volatile u64 sink = 0;
+    auto result = counters.measure([&sink] {
+        for(u64 index = 0; index < 100'000; ++index) {
+            sink = sink + index;
+        }
+    });
+    ASSERT_TRUE(result);
+
+    // Counters are commonly unavailable in containers and VMs, so only check consistency
+    ASSERT_EQ(result->is_available(PerfCounter::INSTRUCTIONS), counters.is_available(PerfCounter::INSTRUCTIONS));
+    if(counters.is_available(PerfCounter::INSTRUCTIONS)) {
+        ASSERT_GT(*result->get_instructions(), 100'000);
+    }
+    else {
+        ASSERT_FALSE(result->get_instructions());
+    }
+}
+
+TEST(kstd_PerfCounters, test_move) {
+    auto counters = PerfCounters::open();
+    const auto has_any = counters.has_any();
+    auto moved = std::move(counters);
+    ASSERT_FALSE(counters.has_any());// NOLINT
+    ASSERT_EQ(moved.has_any(), has_any);
+}
@@ -0,0 +1,140 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <kstd/quotient_filter.hpp>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace kstd;
+
+TEST(kstd_QuotientFilter, test_insert_contains_remove) {
+    QuotientFilter filter {10, 8};
+    ASSERT_EQ(filter.get_slot_count(), 1024);
+
+    for(u32 index = 0; index < 500; ++index) {
+        ASSERT_TRUE(filter.insert(index));
+    }
+    ASSERT_EQ(filter.get_size(), 500);
+    for(u32 index = 0; index < 500; ++index) {
+        ASSERT_TRUE(filter.contains(index));
+    }
+    for(u32 index = 0; index < 500; index += 2) {
+        ASSERT_TRUE(filter.remove(index));
+    }
+    for(u32 index = 1; index < 500; index += 2) {
+        ASSERT_TRUE(filter.contains(index));
+    }
+
+    usize false_positives = 0;
+    for(u32 index = 1000; index < 11'000; ++index) {
+        if(filter.contains(index)) {
+            ++false_positives;
+        }
+    }
+    ASSERT_LT(false_positives, 200);
+}
+
+TEST(kstd_QuotientFilter, test_matches_model) {
+    // Fingerprints are stored exactly, so the filter must behave like a set of fingerprints
+    QuotientFilter filter {8, 4};
+    const auto mask = (u64 {1} << 12) - 1;
+    std::set<u64> model {};
+    std::mt19937_64 random {1234};
+
+    for(usize step = 0; step < 20'000; ++step) {
+        const auto fingerprint = random() & mask;
+        if((random() % 3) != 0 && model.size() < 240) {
+            ASSERT_TRUE(filter.insert_hash(fingerprint));
+            model.insert(fingerprint);
+        }
+        else {
+            ASSERT_EQ(filter.remove_hash(fingerprint), model.erase(fingerprint) == 1);
+        }
+        ASSERT_EQ(filter.get_size(), model.size());
+        if(step % 500 == 0) {
+            for(u64 value = 0; value <= mask; ++value) {
+                ASSERT_EQ(filter.contains_hash(value), model.count(value) == 1);
+            }
+            std::set<u64> stored {};
+            filter.for_each_fingerprint([&](u64 value) {
+                stored.insert(value);
+            });
+            ASSERT_EQ(stored, model);
+        }
+    }
+}
+
+TEST(kstd_QuotientFilter, test_full) {
+    QuotientFilter filter {4, 4};
+    usize inserted = 0;
+    for(u64 value = 0; value < 256; value += 7) {
+        if(!filter.insert_hash(value)) {
+            break;
+        }
+        ++inserted;
+    }
+    ASSERT_EQ(inserted, 15);
+    ASSERT_EQ(filter.get_size(), 15);
+}
+
+TEST(kstd_QuotientFilter, test_merge_serialize) {
+    QuotientFilter first {12, 10};
+    QuotientFilter second {12, 10};
+    for(u32 index = 0; index < 1000; ++index) {
+        ASSERT_TRUE(first.insert(index));
+        ASSERT_TRUE(second.insert(index + 500));
+    }
+    ASSERT_TRUE(first.merge(second));
+    for(u32 index = 0; index < 1500; ++index) {
+        ASSERT_TRUE(first.contains(index));
+    }
+    ASSERT_FALSE(first.merge(QuotientFilter {11, 10}));
+
+    std::vector<u8> bytes(first.get_serialized_size());
+    ASSERT_FALSE(first.serialize({bytes.data(), 8}));
+    ASSERT_TRUE(first.serialize({bytes.data(), bytes.size()}));
+    auto copy = QuotientFilter::deserialize(Slice<const u8> {bytes.data(), bytes.size()});
+    ASSERT_TRUE(copy);
+    ASSERT_EQ(copy->get_size(), first.get_size());
+    for(u32 index = 0; index < 1500; ++index) {
+        ASSERT_TRUE(copy->contains(index));
+    }
+    ASSERT_FALSE(QuotientFilter::deserialize(Slice<const u8> {bytes.data(), bytes.size() - 1}));
+}
+
+TEST(kstd_QuotientFilter, test_deserialize_corrupt_header) {
+    QuotientFilter filter {4, 8};
+    ASSERT_TRUE(filter.insert(1));
+    std::vector<u8> bytes(filter.get_serialized_size());
+    ASSERT_TRUE(filter.serialize({bytes.data(), bytes.size()}));
+
+    // A large quotient must be rejected by the length check instead of allocating its slots
+    auto corrupt = bytes;
+    const u32 quotient_bits = 40;
+    std::memcpy(corrupt.data() + 8, &quotient_bits, sizeof(u32));
+    ASSERT_FALSE(QuotientFilter::deserialize(Slice<const u8> {corrupt.data(), corrupt.size()}));
+
+    corrupt = bytes;
+    const u64 size = 17;
+    std::memcpy(corrupt.data() + 16, &size, sizeof(u64));
+    ASSERT_FALSE(QuotientFilter::deserialize(Slice<const u8> {corrupt.data(), corrupt.size()}));
+}
@@ -0,0 +1,157 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <kstd/radix_sort.hpp>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace kstd;
+
+template<typename T>
+static auto make_slice(std::vector<T>& values) -> Slice<T> {
+    return {values.data(), values.size() * sizeof(T)};
+}
+
+template<typename T, typename D>
+static auto test_against_std(usize count, D distribution, usize thread_count) -> void {
+    std::mt19937_64 random {count};
+    std::vector<T> values(count);
+    for(auto& value : values) {
+        value = static_cast<T>(distribution(random));
+    }
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    std::vector<T> scratch(count);
+    ASSERT_TRUE(radix_sort(make_slice(values), make_slice(scratch), thread_count));
+    ASSERT_EQ(values, expected);
+}
+
+TEST(kstd_radix_sort, test_unsigned) {
+    for(usize count = 0; count < 64; ++count) {
+        test_against_std<u32>(count, std::uniform_int_distribution<u32> {}, 1);
+    }
+    test_against_std<u8>(10000, std::uniform_int_distribution<u32> {0, 255}, 1);
+    test_against_std<u16>(10000, std::uniform_int_distribution<u32> {0, 65535}, 1);
+    test_against_std<u32>(100000, std::uniform_int_distribution<u32> {}, 1);
+    test_against_std<u64>(100000, std::uniform_int_distribution<u64> {}, 1);
+    test_against_std<u64>(100000, std::uniform_int_distribution<u64> {0, 1000}, 1);
+}
+
+TEST(kstd_radix_sort, test_signed) {
+    test_against_std<i32>(100000, std::uniform_int_distribution<i32> {}, 1);
+    test_against_std<i64>(100000, std::uniform_int_distribution<i64> {-1000, 1000}, 1);
+}
+
+TEST(kstd_radix_sort, test_float) {
+    test_against_std<f32>(100000, std::uniform_real_distribution<f32> {-1e6F, 1e6F}, 1);
+    test_against_std<f64>(100000, std::uniform_real_distribution<f64> {-1e6, 1e6}, 1);
+
+    std::vector<f32> values {1.0F, -std::numeric_limits<f32>::infinity(), -2.5F, 0.0F,
+                             std::numeric_limits<f32>::infinity()};
+    radix_sort(make_slice(values));
+    ASSERT_EQ(values, (std::vector<f32> {-std::numeric_limits<f32>::infinity(), -2.5F, 0.0F, 1.0F,
+                                         std::numeric_limits<f32>::infinity()}));
+}
+
+TEST(kstd_radix_sort, test_parallel) {
+    test_against_std<u32>(200000, std::uniform_int_distribution<u32> {}, 4);
+    test_against_std<i64>(200000, std::uniform_int_distribution<i64> {}, 3);
+    test_against_std<u32>(100, std::uniform_int_distribution<u32> {}, 8);
+}
+
+TEST(kstd_radix_sort, test_scratch_too_small) {
+    std::vector<u32> values {3, 2, 1};
+    std::vector<u32> scratch(2);
+    const auto result = radix_sort(make_slice(values), make_slice(scratch));
+    ASSERT_TRUE(result.is_error());
+    ASSERT_EQ(values, (std::vector<u32> {3, 2, 1}));
+}
+
+TEST(kstd_radix_sort, test_by_key_is_stable) {
+    std::mt19937 random {1};
+    std::vector<std::pair<i32, usize>> values(50000);
+    for(usize index = 0; index < values.size(); ++index) {
+        values[index] = {static_cast<i32>(random() % 200) - 100, index};
+    }
+    auto expected = values;
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    });
+    for(const usize thread_count : {1, 4}) {
+        auto sorted = values;
+        std::vector<std::pair<i32, usize>> scratch(values.size());
+        ASSERT_TRUE(radix_sort_by_key(make_slice(sorted), make_slice(scratch),
+                                      [](const std::pair<i32, usize>& value) {
+                                          return value.first;
+                                      },
+                                      thread_count));
+        ASSERT_EQ(sorted, expected);
+    }
+}
+
+TEST(kstd_radix_sort, test_strings) {
+    std::mt19937 random {1};
+    std::vector<std::string> storage(20000);
+    for(auto& value : storage) {
+        const auto length = random() % 12;
+        for(usize index = 0; index < length; ++index) {
+            value.push_back(static_cast<char>('a' + random() % 4));
+        }
+    }
+    storage.emplace_back("\xFF\x01");
+    storage.emplace_back();
+    std::vector<std::string_view> values(storage.begin(), storage.end());
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    for(const usize thread_count : {1, 4}) {
+        auto sorted = values;
+        std::vector<std::string_view> scratch(values.size());
+        ASSERT_TRUE(radix_sort(make_slice(sorted), make_slice(scratch), thread_count));
+        ASSERT_EQ(sorted, expected);
+    }
+
+    std::vector<std::string_view> small {"b", "ab", "a", ""};
+    radix_sort(make_slice(small));
+    ASSERT_EQ(small, (std::vector<std::string_view> {"", "a", "ab", "b"}));
+}
+
+TEST(kstd_radix_sort, test_strings_with_long_shared_prefixes) {
+    // Every pass leaves all but one string in the same bucket
+    std::vector<std::string> storage;
+    for(usize length = 0; length < 5000; ++length) {
+        storage.push_back(std::string(length, 'a') + 'b');
+    }
+    std::vector<std::string_view> values(storage.rbegin(), storage.rend());
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    for(const usize thread_count : {1, 4}) {
+        auto sorted = values;
+        std::vector<std::string_view> scratch(values.size());
+        ASSERT_TRUE(radix_sort(make_slice(sorted), make_slice(scratch), thread_count));
+        ASSERT_EQ(sorted, expected);
+    }
+}
@@ -0,0 +1,104 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/rcu_cell.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kstd;
+
+namespace {
+    struct Config final {
+        std::string name;
+        std::vector<usize> values;
+    };
+}// namespace
+
+TEST(kstd_RcuCell, test_read_publish) {
+    Epoch epoch {};
+    RcuCell<Config> cell {{"initial", {1, 2, 3}}, epoch};
+
+    {
+        auto guard = cell.read();
+        ASSERT_EQ(guard->name, "initial");
+        cell.publish({"second", {4}});
+        // The old version stays valid while the guard is alive
+        ASSERT_EQ(guard->name, "initial");
+        ASSERT_EQ((*guard).values.size(), 3);
+    }
+
+    ASSERT_EQ(cell.read()->name, "second");
+    cell.update([](const Config& config) {
+        auto next = config;
+        next.values.push_back(5);
+        return next;
+    });
+    ASSERT_EQ(cell.load().values.size(), 2);
+    ASSERT_EQ(epoch.get_pending_count(), 2);
+
+    for(usize index = 0; index < 4; ++index) {
+        epoch.collect();
+    }
+    ASSERT_EQ(epoch.get_pending_count(), 0);
+}
+
+TEST(kstd_RcuCell, test_concurrent_updates) {
+    Epoch epoch {16};
+    RcuCell<Config> cell {{"0", {0}}, epoch};
+    std::atomic_bool running {true};
+    atomic_usize errors {0};
+
+    std::vector<std::thread> readers {};
+    for(usize index = 0; index < 3; ++index) {
+        readers.emplace_back([&] {
+            while(running.load(std::memory_order_relaxed)) {
+                const auto guard = cell.read();
+                if(guard->values.size() != guard->values.back() + 1 || guard->name != std::to_string(guard->values.back())) {
+                    errors.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> writers {};
+    for(usize index = 0; index < 2; ++index) {
+        writers.emplace_back([&] {
+            for(usize count = 0; count < 2000; ++count) {
+                cell.update([](const Config& config) {
+                    auto next = config;
+                    next.values.push_back(next.values.size());
+                    next.name = std::to_string(next.values.back());
+                    return next;
+                });
+            }
+        });
+    }
+    for(auto& writer : writers) {
+        writer.join();
+    }
+    running = false;
+    for(auto& reader : readers) {
+        reader.join();
+    }
+
+    ASSERT_EQ(errors.load(), 0);
+    ASSERT_EQ(cell.read()->values.size(), 4001);
+}
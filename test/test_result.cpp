@@ -592,4 +592,17 @@ TEST(kstd_Result, test_get_or_throw) {
 
     result = "This is a value now!"s;
     ASSERT_EQ(result.get_or_throw(), "This is a value now!"s);
-}
\ No newline at end of file
+}
+
+TEST(kstd_Result, test_forward_move) {
+    using namespace std::string_literals;
+
+    Result<i32> result {Error {"Something went wrong"s}};
+    const auto copied = result.template forward<std::string>();
+    ASSERT_TRUE(copied.is_error());
+    ASSERT_EQ(result.get_error(), "Something went wrong"s);
+
+    const auto moved = std::move(result).template forward<std::string>();
+    ASSERT_TRUE(moved.is_error());
+    ASSERT_EQ(moved.get_error(), "Something went wrong"s);
+}
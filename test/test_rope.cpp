@@ -0,0 +1,114 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/rope.hpp>
+#include <random>
+#include <string>
+
+using namespace kstd;
+
+TEST(kstd_Rope, test_edit) {
+    Rope<char> rope {"Hello World"};
+    rope.insert(5, ",");
+    rope.append("!");
+    rope.prepend(">> ");
+    ASSERT_EQ(rope, ">> Hello, World!");
+    ASSERT_EQ(rope.get_length(), 16);
+    ASSERT_EQ(rope[3], 'H');
+
+    rope.erase(0, 3);
+    ASSERT_EQ(rope.to_string(), "Hello, World!");
+    ASSERT_EQ(rope.substr(7, 5), "World");
+
+    auto [first, second] = rope.split_at(5);
+    ASSERT_EQ(first, "Hello");
+    ASSERT_EQ(second + first, ", World!Hello");
+    ASSERT_EQ(rope, "Hello, World!");// Persistent, splitting doesn't modify the source
+
+    rope.clear();
+    ASSERT_TRUE(rope.is_empty());
+}
+
+TEST(kstd_Rope, test_large_chunks) {
+    std::string body(1 << 20, 'x');
+    const auto* data = body.data();
+    Rope<char> rope {std::move(body)};
+    rope.prepend("HTTP/1.1 200 OK\r\n\r\n");
+    rope.append(std::string(1 << 20, 'y'));
+
+    const auto chunks = rope.get_chunks();
+    ASSERT_EQ(chunks.size(), 3);
+    ASSERT_EQ(chunks[1].get_data(), data);// Moved in without copying
+    usize total = 0;
+    for(const auto& chunk : chunks) {
+        total += chunk.get_count();
+    }
+    ASSERT_EQ(total, rope.get_length());
+
+    rope.insert(1 << 19, "marker");
+    ASSERT_EQ(rope.substr(1 << 19, 6), "marker");
+}
+
+TEST(kstd_Rope, test_matches_model) {
+    Rope<char> rope {};
+    std::string model {};
+    std::mt19937 random {42};
+
+    for(usize step = 0; step < 5000; ++step) {
+        const auto operation = random() % 4;
+        const auto index = model.empty() ? 0 : random() % (model.size() + 1);
+        if(operation < 2) {
+            const std::string piece(1 + random() % 40, static_cast<char>('a' + step % 26));
+            rope.insert(index, piece);
+            model.insert(index, piece);
+        }
+        else if(operation == 2) {
+            const auto count = random() % 30;
+            rope.erase(index, count);
+            model.erase(index, count);
+        }
+        else {
+            rope.append(std::to_string(step));
+            model.append(std::to_string(step));
+        }
+        ASSERT_EQ(rope.get_length(), model.size());
+    }
+    ASSERT_EQ(rope.to_string(), model);
+    // An AVL tree over n chunks is at most ~1.44 log2(n) deep
+    ASSERT_LT(rope.get_depth(), 30);
+}
+
+TEST(kstd_Rope, test_code_points) {
+    Rope<char> rope {"h\xC3\xA4llo "};       // "hällo "
+    rope.append("w\xC3\xB6rld \xF0\x9F\x98\x80");// "wörld 😀"
+    ASSERT_EQ(rope.get_length(), 18);
+    ASSERT_EQ(rope.get_code_point_count(), 13);
+    ASSERT_EQ(rope.get_index_of_code_point(2), 3);
+    ASSERT_EQ(rope.get_index_of_code_point(12), 14);
+    ASSERT_EQ(rope.get_index_of_code_point(13), 18);
+
+    // Code points split across chunks are only counted once
+    auto [first, second] = rope.split_at(2);
+    ASSERT_EQ(first.get_code_point_count() + second.get_code_point_count(), 13);
+
+    Rope<char16_t> wide {u"a\xD83D\xDE00z"};
+    ASSERT_EQ(wide.get_code_point_count(), 3);
+    ASSERT_EQ(wide.get_index_of_code_point(2), 3);
+}
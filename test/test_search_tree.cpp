@@ -0,0 +1,122 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <kstd/search_tree.hpp>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kstd;
+
+template<typename T>
+static auto make_sorted(usize count, u64 seed, T modulo) -> std::vector<T> {
+    std::mt19937_64 random {seed};
+    std::vector<T> values(count);
+    for(auto& value : values) {
+        value = static_cast<T>(random() % static_cast<u64>(modulo));
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+template<typename INDEX, typename T>
+static auto test_against_std(const std::vector<T>& sorted, const std::vector<T>& queries) -> void {
+    const INDEX index {Slice<const T> {sorted.data(), sorted.size() * sizeof(T)}};
+    ASSERT_EQ(index.get_size(), sorted.size());
+    std::vector<usize> expected(queries.size());
+    for(usize query = 0; query < queries.size(); ++query) {
+        const auto& key = queries[query];
+        expected[query] = static_cast<usize>(std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+        ASSERT_EQ(index.lower_bound(key), expected[query]);
+        ASSERT_EQ(index.contains(key), std::binary_search(sorted.begin(), sorted.end(), key));
+    }
+    std::vector<usize> results(queries.size());
+    index.lower_bound_many(Slice<const T> {queries.data(), queries.size() * sizeof(T)},
+                           Slice<usize> {results.data(), results.size() * sizeof(usize)});
+    ASSERT_EQ(results, expected);
+}
+
+TEST(kstd_EytzingerIndex, test_lower_bound) {
+    for(usize count = 0; count < 70; ++count) {
+        test_against_std<EytzingerIndex<i32>>(make_sorted<i32>(count, count, 100), make_sorted<i32>(50, 7, 110));
+    }
+    test_against_std<EytzingerIndex<u64>>(make_sorted<u64>(100000, 1, 1000000), make_sorted<u64>(1000, 2, 1100000));
+    test_against_std<EytzingerIndex<u32>>(make_sorted<u32>(10000, 3, 10), make_sorted<u32>(100, 4, 12));
+}
+
+TEST(kstd_EytzingerIndex, test_strings) {
+    const std::vector<std::string> sorted {"apple", "banana", "cherry", "date"};
+    const EytzingerIndex<std::string> index {Slice<const std::string> {sorted.data(), sorted.size() * sizeof(std::string)}};
+    ASSERT_EQ(index.lower_bound("banana"), 1);
+    ASSERT_EQ(index.lower_bound("c"), 2);
+    ASSERT_EQ(index.lower_bound("zebra"), 4);
+    ASSERT_TRUE(index.contains("date"));
+    ASSERT_FALSE(index.contains("fig"));
+}
+
+TEST(kstd_StaticSearchTree, test_lower_bound) {
+    for(usize count = 0; count < 70; ++count) {
+        test_against_std<StaticSearchTree<i32>>(make_sorted<i32>(count, count, 100), make_sorted<i32>(50, 7, 110));
+    }
+    test_against_std<StaticSearchTree<i32>>(make_sorted<i32>(100000, 1, 1000000), make_sorted<i32>(1000, 2, 1100000));
+    test_against_std<StaticSearchTree<u32>>(make_sorted<u32>(100000, 3, 50), make_sorted<u32>(100, 4, 60));
+    test_against_std<StaticSearchTree<u64>>(make_sorted<u64>(100000, 5, 1000000), make_sorted<u64>(1000, 6, 1100000));
+    test_against_std<StaticSearchTree<f32>>(make_sorted<f32>(50000, 7, 100000), make_sorted<f32>(1000, 8, 110000));
+}
+
+TEST(kstd_StaticSearchTree, test_node_size) {
+    test_against_std<StaticSearchTree<i32, 4>>(make_sorted<i32>(10000, 1, 100000), make_sorted<i32>(1000, 2, 110000));
+    test_against_std<StaticSearchTree<u16, 3>>(make_sorted<u16>(5000, 3, 60000), make_sorted<u16>(1000, 4, 65535));
+
+    const auto sorted = make_sorted<i32>(100000, 5, 1000000);
+    const StaticSearchTree<i32, 4> tree {Slice<const i32> {sorted.data(), sorted.size() * sizeof(i32)}};
+    ASSERT_GT(tree.get_height(), 5);
+}
+
+TEST(kstd_StaticSearchTree, test_maximum) {
+    const std::vector<i32> sorted(40, std::numeric_limits<i32>::max());
+    const StaticSearchTree<i32> tree {Slice<const i32> {sorted.data(), sorted.size() * sizeof(i32)}};
+    ASSERT_EQ(tree.lower_bound(std::numeric_limits<i32>::max()), 0);
+    ASSERT_TRUE(tree.contains(std::numeric_limits<i32>::max()));
+    ASSERT_EQ(tree.lower_bound(0), 0);
+}
+
+TEST(kstd_StaticSearchTree, test_non_finite_queries) {
+    std::vector<f32> sorted(50);
+    for(usize index = 0; index < sorted.size(); ++index) {
+        sorted[index] = static_cast<f32>(index);
+    }
+    const std::vector<f32> queries {std::numeric_limits<f32>::infinity(), -std::numeric_limits<f32>::infinity(),
+                                    std::numeric_limits<f32>::max(), 49.5F};
+    test_against_std<StaticSearchTree<f32>>(sorted, queries);
+    test_against_std<EytzingerIndex<f32>>(sorted, queries);
+
+    // NaN compares false against everything, so the descent always goes left
+    const auto nan = std::numeric_limits<f32>::quiet_NaN();
+    const StaticSearchTree<f32> tree {Slice<const f32> {sorted.data(), sorted.size() * sizeof(f32)}};
+    ASSERT_EQ(tree.lower_bound(std::numeric_limits<f32>::infinity()), 50);
+    ASSERT_EQ(tree.lower_bound(nan), 0);
+    ASSERT_FALSE(tree.contains(nan));
+    std::vector<usize> results(1);
+    tree.lower_bound_many(Slice<const f32> {&nan, sizeof(f32)}, Slice<usize> {results.data(), sizeof(usize)});
+    ASSERT_EQ(results[0], 0);
+}
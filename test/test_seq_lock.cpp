@@ -0,0 +1,97 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/seq_lock.hpp>
+#include <thread>
+#include <vector>
+
+using namespace kstd;
+
+namespace {
+    struct Route final {
+        u64 id = 0;
+        u64 doubled = 0;
+        u32 tripled = 0;
+        u8 flags = 0;
+    };
+}// namespace
+
+TEST(kstd_SeqLock, test_read_write) {
+    SeqLock<Route> lock {Route {1, 2, 3, 4}};
+    ASSERT_EQ(lock.read().id, 1);
+    ASSERT_EQ(lock.read().flags, 4);
+    ASSERT_EQ(lock.get_sequence(), 0);
+
+    lock.write({5, 10, 15, 0});
+    ASSERT_EQ(lock.read().doubled, 10);
+    ASSERT_EQ(lock.get_sequence(), 2);
+
+    lock.update([](Route& route) {
+        route.flags = 0xFF;
+    });
+    Route route {};
+    ASSERT_TRUE(lock.try_read(route));
+    ASSERT_EQ(route.id, 5);
+    ASSERT_EQ(route.flags, 0xFF);
+}
+
+TEST(kstd_SeqLock, test_concurrent_consistency) {
+    SeqLock<Route> lock {};
+    std::atomic_bool running {true};
+    atomic_usize errors {0};
+    atomic_usize reads {0};
+
+    std::vector<std::thread> readers {};
+    for(usize index = 0; index < 3; ++index) {
+        readers.emplace_back([&] {
+            while(running.load(std::memory_order_relaxed)) {
+                const auto route = lock.read();
+                if(route.doubled != route.id * 2 || route.tripled != static_cast<u32>(route.id * 3)) {
+                    errors.fetch_add(1);
+                }
+                reads.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    std::vector<std::thread> writers {};
+    for(usize index = 0; index < 2; ++index) {
+        writers.emplace_back([&] {
+            for(u64 id = 1; id <= 20'000; ++id) {
+                lock.update([](Route& route) {
+                    route.id += 1;
+                    route.doubled = route.id * 2;
+                    route.tripled = static_cast<u32>(route.id * 3);
+                });
+            }
+        });
+    }
+    for(auto& writer : writers) {
+        writer.join();
+    }
+    running = false;
+    for(auto& reader : readers) {
+        reader.join();
+    }
+
+    ASSERT_EQ(errors.load(), 0);
+    ASSERT_EQ(lock.read().id, 40'000);
+    ASSERT_EQ(lock.get_sequence(), 80'000);
+}
@@ -0,0 +1,151 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <kstd/sort.hpp>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace kstd;
+
+template<typename T>
+static auto make_slice(std::vector<T>& values) -> Slice<T> {
+    return {values.data(), values.size() * sizeof(T)};
+}
+
+template<typename T, typename D>
+static auto test_against_std(usize count, D distribution) -> void {
+    std::mt19937_64 random {count};
+    std::vector<T> values(count);
+    for(auto& value : values) {
+        value = static_cast<T>(distribution(random));
+    }
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    kstd::sort(make_slice(values));
+    ASSERT_EQ(values, expected);
+}
+
+TEST(kstd_sort, test_u32) {
+    for(usize count = 0; count < 100; ++count) {
+        test_against_std<u32>(count, std::uniform_int_distribution<u32> {});
+    }
+    test_against_std<u32>(100000, std::uniform_int_distribution<u32> {});
+}
+
+TEST(kstd_sort, test_i32) {
+    for(usize count = 0; count < 100; ++count) {
+        test_against_std<i32>(count, std::uniform_int_distribution<i32> {});
+    }
+    test_against_std<i32>(100000, std::uniform_int_distribution<i32> {});
+    test_against_std<i32>(100000, std::uniform_int_distribution<i32> {-4, 4});
+}
+
+TEST(kstd_sort, test_u64) {
+    test_against_std<u64>(100000, std::uniform_int_distribution<u64> {});
+    test_against_std<u64>(100000, std::uniform_int_distribution<u64> {0, 2});
+}
+
+TEST(kstd_sort, test_f32) {
+    test_against_std<f32>(100000, std::uniform_real_distribution<f32> {-1000.0F, 1000.0F});
+
+    std::vector<f32> values {1.0F, -0.0F, std::numeric_limits<f32>::infinity(), -2.5F, 0.0F,
+                             -std::numeric_limits<f32>::infinity(), std::numeric_limits<f32>::quiet_NaN()};
+    kstd::sort(make_slice(values));
+    ASSERT_EQ(values[0], -std::numeric_limits<f32>::infinity());
+    ASSERT_EQ(values[1], -2.5F);
+    ASSERT_TRUE(std::signbit(values[2]));
+    ASSERT_FALSE(std::signbit(values[3]));
+    ASSERT_EQ(values[4], 1.0F);
+    ASSERT_EQ(values[5], std::numeric_limits<f32>::infinity());
+    ASSERT_TRUE(std::isnan(values[6]));
+}
+
+TEST(kstd_sort, test_patterns) {
+    constexpr usize count = 50000;
+    std::vector<u32> sorted(count);
+    for(usize index = 0; index < count; ++index) {
+        sorted[index] = static_cast<u32>(index);
+    }
+    auto values = sorted;
+    kstd::sort(make_slice(values));
+    ASSERT_EQ(values, sorted);
+
+    std::reverse(values.begin(), values.end());
+    kstd::sort(make_slice(values));
+    ASSERT_EQ(values, sorted);
+
+    std::vector<u32> equal(count, 42);
+    kstd::sort(make_slice(equal));
+    ASSERT_TRUE(std::all_of(equal.begin(), equal.end(), [](u32 value) {
+        return value == 42;
+    }));
+
+    std::vector<u32> organ_pipe(count);
+    for(usize index = 0; index < count; ++index) {
+        organ_pipe[index] = static_cast<u32>(std::min(index, count - index));
+    }
+    auto expected = organ_pipe;
+    std::sort(expected.begin(), expected.end());
+    kstd::sort(make_slice(organ_pipe));
+    ASSERT_EQ(organ_pipe, expected);
+}
+
+TEST(kstd_sort, test_comparator) {
+    std::vector<std::string> values {"delta", "alpha", "charlie", "bravo", "echo"};
+    kstd::sort(make_slice(values), std::greater<std::string> {});
+    ASSERT_EQ(values, (std::vector<std::string> {"echo", "delta", "charlie", "bravo", "alpha"}));
+}
+
+TEST(kstd_sort, test_move_only) {
+    std::mt19937 random {1};
+    std::vector<std::unique_ptr<u32>> values(10000);
+    for(auto& value : values) {
+        value = std::make_unique<u32>(random() % 100);
+    }
+    kstd::sort(make_slice(values), [](const std::unique_ptr<u32>& lhs, const std::unique_ptr<u32>& rhs) {
+        return *lhs < *rhs;
+    });
+    ASSERT_TRUE(std::all_of(values.begin(), values.end(), [](const std::unique_ptr<u32>& value) {
+        return value != nullptr;
+    }));
+    ASSERT_TRUE(std::is_sorted(values.begin(), values.end(), [](const auto& lhs, const auto& rhs) {
+        return *lhs < *rhs;
+    }));
+}
+
+TEST(kstd_sort, test_sort_by_key) {
+    std::mt19937 random {1};
+    std::vector<std::pair<u32, usize>> values(10000);
+    for(usize index = 0; index < values.size(); ++index) {
+        values[index] = {static_cast<u32>(random() % 100), index};
+    }
+    kstd::sort_by_key(make_slice(values), [](const std::pair<u32, usize>& value) {
+        return value.first;
+    });
+    ASSERT_TRUE(std::is_sorted(values.begin(), values.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    }));
+}
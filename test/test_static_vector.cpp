@@ -19,6 +19,7 @@
 
 #include <gtest/gtest.h>
 #include <kstd/static_vector.hpp>
+#include <string>
 
 using namespace kstd;
 
@@ -119,6 +120,26 @@ TEST(kstd_StaticVector, test_insert) {
     }
 }
 
+TEST(kstd_StaticVector, test_insert_erase_strings) {
+    StaticVector<std::string, 8> values {std::string {"a"}, std::string {"c"}, std::string {"d"}};
+    values.insert(1, "b");
+    values.push_front("_");
+    ASSERT_EQ(values.get_size(), 5);
+    ASSERT_EQ(values[0], "_");
+    ASSERT_EQ(values[1], "a");
+    ASSERT_EQ(values[2], "b");
+    ASSERT_EQ(values[3], "c");
+    ASSERT_EQ(values[4], "d");
+
+    ASSERT_EQ(values.erase(2), "b");
+    ASSERT_EQ(values.get_size(), 4);
+    ASSERT_EQ(values[2], "c");
+    ASSERT_EQ(values[3], "d");
+
+    values.clear();
+    ASSERT_EQ(values.get_size(), 0);
+}
+
 TEST(kstd_StaticVector, test_replace) {
     StaticVector<u32, 10> values {11U, 22U, 22U, 44U, 55U};
     ASSERT_EQ(values.get_capacity(), 10);
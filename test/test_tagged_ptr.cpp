@@ -0,0 +1,116 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/tagged_ptr.hpp>
+#include <thread>
+#include <vector>
+
+using namespace kstd;
+
+namespace {
+    struct alignas(8) Node final {
+        Node* next = nullptr;
+        usize value = 0;
+    };
+
+    // A Treiber stack which relies on the tag as ABA counter
+    struct Stack final {
+        AtomicTaggedPtr<Node, 10> head {};
+
+        auto push(Node* node) noexcept -> void {
+            auto current = head.load(std::memory_order_relaxed);
+            do {
+                node->next = current.get();
+            } while(!head.compare_exchange_weak(current, current.with_pointer(node).with_next_tag(),
+                                                std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        auto pop() noexcept -> Node* {
+            auto current = head.load(std::memory_order_acquire);
+            while(current) {
+                if(head.compare_exchange_weak(current, current.with_pointer(current->next).with_next_tag(),
+                                              std::memory_order_acquire, std::memory_order_acquire)) {
+                    return current.get();
+                }
+            }
+            return nullptr;
+        }
+    };
+}// namespace
+
+TEST(kstd_TaggedPtr, test_layout) {
+    static_assert(sizeof(TaggedPtr<Node, 10>) == sizeof(void*));
+    static_assert(TaggedPtr<Node, 10>::low_bits == 3);
+    static_assert(TaggedPtr<Node, 3>::tag_high_bits == 0);
+    static_assert(TaggedPtr<Node, 10>::tag_high_bits == 7);
+    static_assert(TaggedPtr<u16, 1>::tag_low_bits == 1);
+    ASSERT_TRUE((AtomicTaggedPtr<Node, 10> {}.is_lock_free()));
+}
+
+TEST(kstd_TaggedPtr, test_pack_unpack) {
+    Node node {nullptr, 42};
+    TaggedPtr<Node, 10> pointer {&node, 0x2CD};
+    ASSERT_EQ(pointer.get(), &node);
+    ASSERT_EQ(pointer.get_tag(), 0x2CD);
+    ASSERT_EQ(pointer->value, 42);
+
+    const auto next = pointer.with_next_tag();
+    ASSERT_EQ(next.get(), &node);
+    ASSERT_EQ(next.get_tag(), 0x2CE);
+    ASSERT_EQ(pointer.with_tag(TaggedPtr<Node, 10>::max_tag).with_next_tag().get_tag(), 0);
+
+    TaggedPtr<Node, 2> flags {&node, 0b10};
+    ASSERT_EQ(flags.get(), &node);
+    ASSERT_EQ(flags.get_tag(), 0b10);
+    ASSERT_EQ(flags.get_raw() & ~usize {0b11}, reinterpret_cast<usize>(&node));
+
+    const TaggedPtr<Node, 10> null {nullptr, 7};
+    ASSERT_FALSE(null);
+    ASSERT_EQ(null.get_tag(), 7);
+}
+
+TEST(kstd_TaggedPtr, test_concurrent_stack) {
+    constexpr usize count_per_thread = 10'000;
+    std::vector<Node> nodes(count_per_thread * 4);
+    Stack stack {};
+    for(auto& node : nodes) {
+        stack.push(&node);
+    }
+
+    std::vector<std::thread> threads {};
+    for(usize index = 0; index < 4; ++index) {
+        threads.emplace_back([&stack] {
+            for(usize iteration = 0; iteration < count_per_thread; ++iteration) {
+                auto* node = stack.pop();
+                ASSERT_NE(node, nullptr);
+                stack.push(node);
+            }
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    usize popped = 0;
+    while(stack.pop() != nullptr) {
+        ++popped;
+    }
+    ASSERT_EQ(popped, nodes.size());
+}
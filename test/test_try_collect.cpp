@@ -0,0 +1,95 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+#include <kstd/try_collect.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace kstd;
+
+TEST(kstd_try_transform, test_values) {
+    std::array<i32, 4> values {1, 2, 3, 4};
+    auto result = try_transform(Slice<i32> {values.data(), values.size() * sizeof(i32)},
+                                [](const i32& value) -> Result<std::string> {
+                                    return std::to_string(value * 2);
+                                });
+    ASSERT_TRUE(result);
+    ASSERT_EQ(*result, (std::vector<std::string> {"2", "4", "6", "8"}));
+}
+
+TEST(kstd_try_transform, test_first_error) {
+    std::array<i32, 4> values {1, -2, -3, 4};
+    usize calls = 0;
+    auto result = try_transform(Slice<i32> {values.data(), values.size() * sizeof(i32)},
+                                [&calls](const i32& value) -> Result<i32> {
+                                    ++calls;
+                                    if(value < 0) {
+                                        return Error {std::to_string(value)};
+                                    }
+                                    return value;
+                                });
+    ASSERT_TRUE(result.is_error());
+    ASSERT_EQ(result.get_error(), "-2");
+    ASSERT_EQ(calls, 2);
+}
+
+TEST(kstd_try_transform, test_empty) {
+    auto result = try_transform(Slice<i32> {nullptr, 0}, [](const i32& value) -> Result<i32> {
+        return value;
+    });
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(result->empty());
+}
+
+TEST(kstd_try_collect, test_move_values) {
+    std::vector<Result<std::unique_ptr<i32>>> results {};
+    results.emplace_back(std::make_unique<i32>(1));
+    results.emplace_back(std::make_unique<i32>(2));
+    auto result = try_collect(std::move(results));
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->size(), 2);
+    ASSERT_EQ(*(*result)[1], 2);
+}
+
+TEST(kstd_try_collect, test_move_error) {
+    std::vector<Result<i32>> results {};
+    results.emplace_back(1);
+    results.emplace_back(Error {std::string {"First"}});
+    results.emplace_back(Error {std::string {"Second"}});
+    auto result = try_collect(std::move(results));
+    ASSERT_TRUE(result.is_error());
+    ASSERT_EQ(result.get_error(), "First");
+}
+
+TEST(kstd_try_collect, test_slice) {
+    std::array<Result<i32>, 3> results {Result<i32> {1}, Result<i32> {2}, Result<i32> {3}};
+    auto result = try_collect(Slice<const Result<i32>> {results.data(), results.size() * sizeof(Result<i32>)});
+    ASSERT_TRUE(result);
+    ASSERT_EQ(*result, (std::vector<i32> {1, 2, 3}));
+    ASSERT_TRUE(results[0]);
+
+    results[1] = Error {std::string {"Error"}};
+    auto error = try_collect(Slice<Result<i32>> {results.data(), results.size() * sizeof(Result<i32>)});
+    ASSERT_TRUE(error.is_error());
+    ASSERT_EQ(error.get_error(), "Error");
+    ASSERT_EQ(results[1].get_error(), "Error");
+}
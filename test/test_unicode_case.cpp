@@ -0,0 +1,137 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/unicode_case.hpp>
+#include <string>
+#include <string_view>
+
+using namespace kstd;
+using namespace std::string_view_literals;
+
+TEST(kstd_unicode_case, test_code_points) {
+    ASSERT_EQ(unicode::to_lower(U'A'), U'a');
+    ASSERT_EQ(unicode::to_upper(U'a'), U'A');
+    ASSERT_EQ(unicode::to_lower(U'1'), U'1');
+    ASSERT_EQ(unicode::to_lower(U'Ä'), U'ä');
+    ASSERT_EQ(unicode::to_upper(U'ÿ'), U'Ÿ');
+    ASSERT_EQ(unicode::to_lower(U'Σ'), U'σ');
+    ASSERT_EQ(unicode::to_upper(U'ς'), U'Σ');
+    ASSERT_EQ(unicode::case_fold(U'ς'), U'σ');
+    ASSERT_EQ(unicode::to_lower(U'İ'), U'i');
+    ASSERT_EQ(unicode::case_fold(U'İ'), U'İ');
+    ASSERT_EQ(unicode::to_upper(U'ß'), U'ß');
+    ASSERT_EQ(unicode::case_fold(U'ẞ'), U'ß');
+    ASSERT_EQ(unicode::case_fold(U'K'), U'k');
+    ASSERT_EQ(unicode::case_fold(U'ſ'), U's');
+    ASSERT_EQ(unicode::to_lower(U'\U00010400'), U'\U00010428');
+    ASSERT_EQ(unicode::to_upper(U'\U0001E922'), U'\U0001E900');
+    ASSERT_EQ(unicode::to_lower(U'\U0010FFFF'), U'\U0010FFFF');
+    ASSERT_EQ(unicode::to_lower(U'🦊'), U'🦊');
+}
+
+TEST(kstd_unicode_case, test_to_lower_utf8) {
+    ASSERT_EQ(unicode::to_lower("Hello World! ÄÖÜ ΑΒΓ 🦊"sv), "hello world! äöü αβγ 🦊");
+    ASSERT_EQ(unicode::to_lower(""sv), "");
+    // U+023A grows from two to three bytes
+    ASSERT_EQ(unicode::to_lower("ȺȺȺȺ"sv), "ⱥⱥⱥⱥ");
+}
+
+TEST(kstd_unicode_case, test_to_upper_utf8) {
+    ASSERT_EQ(unicode::to_upper(std::string("Hello World! äöü αβγ 🦊")), "HELLO WORLD! ÄÖÜ ΑΒΓ 🦊");
+    // U+0131 shrinks from two bytes to one
+    ASSERT_EQ(unicode::to_upper("ııx"sv), "IIX");
+}
+
+TEST(kstd_unicode_case, test_long_ascii_blocks) {
+    std::string value;
+    std::string expected;
+    for(usize index = 0; index < 200; ++index) {
+        const auto character = static_cast<char>(0x20 + (index * 7) % 0x5F);
+        value += character;
+        expected += (character >= 'A' && character <= 'Z') ? static_cast<char>(character + 0x20) : character;
+        if(index == 100) {
+            value += "Ä";
+            expected += "ä";
+        }
+    }
+    ASSERT_EQ(unicode::to_lower(std::string_view(value)), expected);
+    ASSERT_EQ(unicode::case_fold(value), expected);
+    ASSERT_TRUE(unicode::equals_ignore_case(value, expected));
+}
+
+TEST(kstd_unicode_case, test_illegal_sequences) {
+    ASSERT_EQ(unicode::to_lower("A\x80"
+                                "B\xE2\x82"sv),
+              "a�b�");
+}
+
+TEST(kstd_unicode_case, test_growing_after_ascii_runs) {
+    // Every illegal byte grows into a three byte replacement character right after an ASCII run
+    const auto value = "\xFF\xFF"
+                       "aa"
+                       "\xFF\xFF"
+                       "a"
+                       "\xFF\xFF"
+                       "aaa"
+                       "\xFF\xFF"
+                       "aa"
+                       "\xFF"
+                       "a"
+                       "\xFF\xFF"
+                       "a"sv;
+    std::string expected {};
+    for(const auto character : value) {
+        expected += character == '\xFF' ? "\uFFFD" : std::string(1, character);
+    }
+    ASSERT_EQ(unicode::to_lower(value), expected);
+
+    // U+023A grows from two to three bytes
+    for(usize length = 0; length < 40; ++length) {
+        std::string input {};
+        std::string lower {};
+        for(usize index = 0; index < 8; ++index) {
+            input += std::string(length, 'A') + "\u023A";
+            lower += std::string(length, 'a') + "\u2C65";
+        }
+        ASSERT_EQ(unicode::to_lower(input), lower);
+        ASSERT_EQ(unicode::case_fold(input), lower);
+    }
+}
+
+TEST(kstd_unicode_case, test_utf16_utf32) {
+    ASSERT_EQ(unicode::to_lower(u"ÄB\U00010400"sv), u"äb\U00010428");
+    ASSERT_EQ(unicode::to_upper(U"äb\U00010428"sv), U"ÄB\U00010400");
+    ASSERT_EQ(unicode::case_fold(std::u16string(u"ΣΑΣ")), u"σασ");
+}
+
+TEST(kstd_unicode_case, test_equals_ignore_case) {
+    ASSERT_TRUE(unicode::equals_ignore_case("Content-Type"sv, "content-type"sv));
+    ASSERT_FALSE(unicode::equals_ignore_case("Content-Type"sv, "content-typo"sv));
+    ASSERT_FALSE(unicode::equals_ignore_case("Content"sv, "content-type"sv));
+    ASSERT_TRUE(unicode::equals_ignore_case("", ""));
+    ASSERT_TRUE(unicode::equals_ignore_case("STRASSE", "strasse"));
+    ASSERT_FALSE(unicode::equals_ignore_case("STRASSE", "straße"));
+    ASSERT_TRUE(unicode::equals_ignore_case("Οδυσσεύς", u"ΟΔΥΣΣΕΎΣ"));
+    ASSERT_TRUE(unicode::equals_ignore_case("Kelvin", std::string("kELVIN")));
+    ASSERT_TRUE(unicode::equals_ignore_case(U"ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789abcdefghijklmnopqrstuvwxyz"sv,
+                                            "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"sv));
+    ASSERT_FALSE(unicode::equals_ignore_case("abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyZ"sv,
+                                             "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789ABCDEFGHIJKLMNOPQRSTUVWXY@"sv));
+}
@@ -0,0 +1,95 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/unicode_normalization.hpp>
+#include <string>
+#include <string_view>
+
+using namespace kstd;
+using namespace std::string_view_literals;
+
+TEST(kstd_unicode_normalization, test_combining_class) {
+    ASSERT_EQ(unicode::get_combining_class(U'a'), 0);
+    ASSERT_EQ(unicode::get_combining_class(U'\u0301'), 230);
+    ASSERT_EQ(unicode::get_combining_class(U'\u0323'), 220);
+    ASSERT_EQ(unicode::get_combining_class(U'\U0001E94A'), 7);
+}
+
+TEST(kstd_unicode_normalization, test_quick_check) {
+    ASSERT_EQ(unicode::quick_check(""sv, unicode::NormalForm::NFC), unicode::QuickCheck::YES);
+    ASSERT_EQ(unicode::quick_check("Hello World! \U0001F98A"sv, unicode::NormalForm::NFC), unicode::QuickCheck::YES);
+    ASSERT_EQ(unicode::quick_check("Caf\u00E9"sv, unicode::NormalForm::NFC), unicode::QuickCheck::YES);
+    ASSERT_EQ(unicode::quick_check("Caf\u00E9"sv, unicode::NormalForm::NFD), unicode::QuickCheck::NO);
+    ASSERT_EQ(unicode::quick_check("Cafe\u0301"sv, unicode::NormalForm::NFC), unicode::QuickCheck::MAYBE);
+    ASSERT_EQ(unicode::quick_check("Cafe\u0301"sv, unicode::NormalForm::NFD), unicode::QuickCheck::YES);
+    ASSERT_EQ(unicode::quick_check("q\u0307\u0323"sv, unicode::NormalForm::NFD), unicode::QuickCheck::NO);
+    ASSERT_EQ(unicode::quick_check(std::string("\u212B"), unicode::NormalForm::NFC), unicode::QuickCheck::NO);
+    ASSERT_EQ(unicode::quick_check("A\x80"sv, unicode::NormalForm::NFD), unicode::QuickCheck::NO);
+    ASSERT_EQ(unicode::quick_check(u"\u00C0\u0300"sv, unicode::NormalForm::NFC), unicode::QuickCheck::MAYBE);
+}
+
+TEST(kstd_unicode_normalization, test_is_normalized) {
+    ASSERT_TRUE(unicode::is_normalized("Caf\u00E9"sv, unicode::NormalForm::NFC));
+    ASSERT_FALSE(unicode::is_normalized("Cafe\u0301"sv, unicode::NormalForm::NFC));
+    // U+0301 may compose, but there is nothing it could compose with
+    ASSERT_TRUE(unicode::is_normalized(std::string("x\u0301"), unicode::NormalForm::NFC));
+}
+
+TEST(kstd_unicode_normalization, test_normalize_utf8) {
+    ASSERT_EQ(unicode::normalize("Cafe\u0301"sv, unicode::NormalForm::NFC), "Caf\u00E9");
+    ASSERT_EQ(unicode::normalize("Caf\u00E9"sv, unicode::NormalForm::NFD), "Cafe\u0301");
+    ASSERT_EQ(unicode::normalize("q\u0307\u0323"sv, unicode::NormalForm::NFD), "q\u0323\u0307");
+    ASSERT_EQ(unicode::normalize("\u1E0B\u0323"sv, unicode::NormalForm::NFC), "\u1E0D\u0307");
+    ASSERT_EQ(unicode::normalize("\u212B"sv, unicode::NormalForm::NFC), "\u00C5");
+    ASSERT_EQ(unicode::normalize("\u0958"sv, unicode::NormalForm::NFC), "\u0915\u093C");
+    ASSERT_EQ(unicode::normalize("\u0301abc"sv, unicode::NormalForm::NFC), "\u0301abc");
+    ASSERT_EQ(unicode::normalize("a\x80"
+                                 "b"sv,
+                                 unicode::NormalForm::NFC),
+              "a\uFFFDb");
+}
+
+TEST(kstd_unicode_normalization, test_normalize_hangul) {
+    ASSERT_EQ(unicode::normalize("\uD55C"sv, unicode::NormalForm::NFD), "\u1112\u1161\u11AB");
+    ASSERT_EQ(unicode::normalize("\u1112\u1161\u11AB"sv, unicode::NormalForm::NFC), "\uD55C");
+    ASSERT_EQ(unicode::normalize("\uD558\u11AB"sv, unicode::NormalForm::NFC), "\uD55C");
+}
+
+TEST(kstd_unicode_normalization, test_normalize_utf16_utf32) {
+    ASSERT_EQ(unicode::normalize(u"A\u030A"sv, unicode::NormalForm::NFC), u"\u00C5");
+    ASSERT_EQ(unicode::normalize(std::u32string(U"\u00C5\U0001D15E"), unicode::NormalForm::NFD),
+              U"A\u030A\U0001D157\U0001D165");
+}
+
+TEST(kstd_unicode_normalization, test_normalize_long) {
+    std::string value;
+    std::string expected;
+    for(usize index = 0; index < 100; ++index) {
+        value += "The quick brown fox jumps over the lazy dog. ";
+        expected += "The quick brown fox jumps over the lazy dog. ";
+        if(index % 10 == 0) {
+            value += "Cafe\u0301 ";
+            expected += "Caf\u00E9 ";
+        }
+    }
+    ASSERT_EQ(unicode::quick_check(std::string_view(value), unicode::NormalForm::NFD), unicode::QuickCheck::YES);
+    ASSERT_EQ(unicode::normalize(value, unicode::NormalForm::NFC), expected);
+    ASSERT_EQ(unicode::normalize(expected, unicode::NormalForm::NFD), value);
+}
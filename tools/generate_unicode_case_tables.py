@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+# Copyright 2023 Karma Krafts & associates
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Generates include/kstd/unicode_case_tables.hpp from the Unicode database
+shipped with the running Python interpreter.
+
+Python only exposes full case mappings, the simple (single code point)
+mappings of UnicodeData.txt and CaseFolding.txt are derived from them:
+- Lower case: the full mapping if it is a single code point. The only
+  exception is U+0130, which lower cases to U+0069 U+0307 in full but to
+  U+0069 in UnicodeData.txt.
+- Upper case: the full mapping if it is a single code point, otherwise the
+  title case mapping if that is a single code point (which covers the Greek
+  letters with iota subscript), otherwise no mapping.
+- Case folding: the full folding if it is a single code point (status C),
+  otherwise the simple lower case mapping (status S), except for U+0130,
+  which has no simple folding.
+
+Usage: python3 tools/generate_unicode_case_tables.py > include/kstd/unicode_case_tables.hpp
+"""
+
+import sys
+import unicodedata
+
+HEADER = """// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+// Generated by tools/{script} from Unicode {version}, do not edit.
+
+#pragma once
+
+#include <array>
+
+#include "types.hpp"
+"""
+
+
+def simple_lower(char):
+    if ord(char) == 0x130:
+        return 0x69
+    mapped = char.lower()
+    return ord(mapped) if len(mapped) == 1 else ord(char)
+
+
+def simple_upper(char):
+    mapped = char.upper()
+    if len(mapped) == 1:
+        return ord(mapped)
+    mapped = char.title()
+    return ord(mapped) if len(mapped) == 1 else ord(char)
+
+
+def simple_fold(char):
+    mapped = char.casefold()
+    if len(mapped) == 1:
+        return ord(mapped)
+    if ord(char) == 0x130:
+        return ord(char)
+    return simple_lower(char)
+
+
+def compress(values, shift):
+    """Splits the given values into deduplicated blocks of 2^shift entries."""
+    block_size = 1 << shift
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for start in range(0, len(values), block_size):
+        block = tuple(values[start:start + block_size])
+        block += (0,) * (block_size - len(block))
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return stage1, stage2
+
+
+def get_type(values):
+    maximum = max(values)
+    minimum = min(values)
+    if minimum >= 0:
+        return "u8" if maximum < 1 << 8 else "u16" if maximum < 1 << 16 else "u32" if maximum < 1 << 32 else "u64"
+    return "i8" if -(1 << 7) <= minimum and maximum < 1 << 7 else "i16" if -(1 << 15) <= minimum and maximum < 1 << 15 else "i32"
+
+
+def get_size(values):
+    return len(values) * {"u8": 1, "i8": 1, "u16": 2, "i16": 2, "u32": 4, "i32": 4, "u64": 8}[get_type(values)]
+
+
+def write_array(out, name, values):
+    out.write(f"    constexpr std::array<{get_type(values)}, {len(values)}> {name} {{\n")
+    for start in range(0, len(values), 16):
+        out.write("            " + ", ".join(str(value) for value in values[start:start + 16]) + ",\n")
+    out.write("    };\n\n")
+
+
+def main():
+    records = {(0, 0, 0): 0}
+    indices = []
+    limit = 0
+    for code_point in range(0x110000):
+        record = (0, 0, 0)
+        if not 0xD800 <= code_point <= 0xDFFF:
+            char = chr(code_point)
+            record = (simple_lower(char) - code_point, simple_upper(char) - code_point,
+                      simple_fold(char) - code_point)
+        if record != (0, 0, 0):
+            limit = code_point + 1
+        indices.append(records.setdefault(record, len(records)))
+    indices = indices[:limit]
+
+    shift = min(range(4, 10), key=lambda value: sum(get_size(stage) for stage in compress(indices, value)))
+    stage1, stage2 = compress(indices, shift)
+
+    out = sys.stdout
+    out.write(HEADER.format(script="generate_unicode_case_tables.py", version=unicodedata.unidata_version))
+    out.write("\nnamespace kstd::unicode::tables {\n")
+    out.write(f"    constexpr char32_t case_limit = 0x{limit:X};\n")
+    out.write(f"    constexpr usize case_shift = {shift};\n\n")
+    out.write("    struct CaseRecord final {\n")
+    out.write("        i32 lower_delta;\n        i32 upper_delta;\n        i32 fold_delta;\n    };\n\n")
+    ordered = sorted(records, key=records.get)
+    out.write(f"    constexpr std::array<CaseRecord, {len(ordered)}> case_records {{{{\n")
+    for record in ordered:
+        out.write(f"            {{{record[0]}, {record[1]}, {record[2]}}},\n")
+    out.write("    }};\n\n")
+    write_array(out, "case_stage1", stage1)
+    write_array(out, "case_stage2", stage2)
+    out.write("}// namespace kstd::unicode::tables\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+# Copyright 2023 Karma Krafts & associates
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Generates include/kstd/unicode_normalization_tables.hpp from the Unicode database
+shipped with the running Python interpreter.
+
+The quick check properties are derived from the normalization forms themselves:
+- NFD_QC=No: the code point changes under NFD.
+- NFC_QC=No: the code point changes under NFC (Full_Composition_Exclusion).
+- NFC_QC=Maybe: the code point is the second half of a primary composite,
+  which includes the Hangul vowel and trailing consonant jamo.
+Hangul syllables are decomposed and composed algorithmically, so they have
+no entries in the decomposition and composition tables.
+
+Usage: python3 tools/generate_unicode_normalization_tables.py > include/kstd/unicode_normalization_tables.hpp
+"""
+
+import sys
+import unicodedata
+
+from generate_unicode_case_tables import HEADER, compress, get_size, write_array
+
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+HANGUL_VOWELS = range(0x1161, 0x1176)
+HANGUL_TRAILS = range(0x11A8, 0x11C3)
+
+FLAG_NFD_NO = 1
+FLAG_NFC_NO = 2
+FLAG_NFC_MAYBE = 4
+
+
+def get_canonical_mapping(char):
+    decomposition = unicodedata.decomposition(char)
+    if not decomposition or decomposition.startswith("<"):
+        return []
+    return [int(value, 16) for value in decomposition.split()]
+
+
+def main():
+    chars = [chr(code_point) for code_point in range(0x110000) if not 0xD800 <= code_point <= 0xDFFF]
+
+    compositions = {}
+    for char in chars:
+        mapping = get_canonical_mapping(char)
+        if len(mapping) == 2 and unicodedata.normalize("NFC", chr(mapping[0]) + chr(mapping[1])) == char:
+            compositions[(mapping[0] << 32) | mapping[1]] = ord(char)
+    maybe = {key & 0xFFFFFFFF for key in compositions} | set(HANGUL_VOWELS) | set(HANGUL_TRAILS)
+
+    decompositions = {}
+    records = {(0, 0): 0}
+    indices = [0] * 0x110000
+    limit = 0
+    for char in chars:
+        code_point = ord(char)
+        decomposed = unicodedata.normalize("NFD", char)
+        flags = 0
+        if decomposed != char:
+            flags |= FLAG_NFD_NO
+            if not HANGUL_FIRST <= code_point <= HANGUL_LAST:
+                decompositions[code_point] = [ord(value) for value in decomposed]
+        if unicodedata.normalize("NFC", char) != char:
+            flags |= FLAG_NFC_NO
+        if code_point in maybe:
+            flags |= FLAG_NFC_MAYBE
+        record = (unicodedata.combining(char), flags)
+        if record != (0, 0):
+            limit = code_point + 1
+        indices[code_point] = records.setdefault(record, len(records))
+    indices = indices[:limit]
+
+    ordered = sorted(records, key=records.get)
+
+    # Everything below these code points is a starter which is stable in the respective form
+    nfd_stable_limit = next(code_point for code_point, index in enumerate(indices) if index != 0)
+    nfc_stable_limit = next(code_point for code_point, index in enumerate(indices)
+                            if ordered[index] not in ((0, 0), (0, FLAG_NFD_NO)))
+
+    shift = min(range(4, 10), key=lambda value: sum(get_size(stage) for stage in compress(indices, value)))
+    stage1, stage2 = compress(indices, shift)
+
+    decomposition_keys = sorted(decompositions)
+    decomposition_offsets = [0]
+    decomposition_data = []
+    for code_point in decomposition_keys:
+        decomposition_data.extend(decompositions[code_point])
+        decomposition_offsets.append(len(decomposition_data))
+    composition_keys = sorted(compositions)
+
+    out = sys.stdout
+    out.write(HEADER.format(script="generate_unicode_normalization_tables.py", version=unicodedata.unidata_version))
+    out.write("\nnamespace kstd::unicode::tables {\n")
+    out.write(f"    constexpr char32_t normalization_limit = 0x{limit:X};\n")
+    out.write(f"    constexpr char32_t nfd_stable_limit = 0x{nfd_stable_limit:X};\n")
+    out.write(f"    constexpr char32_t nfc_stable_limit = 0x{nfc_stable_limit:X};\n")
+    out.write(f"    constexpr usize normalization_shift = {shift};\n\n")
+    out.write(f"    constexpr u8 nfd_quick_check_no = {FLAG_NFD_NO};\n")
+    out.write(f"    constexpr u8 nfc_quick_check_no = {FLAG_NFC_NO};\n")
+    out.write(f"    constexpr u8 nfc_quick_check_maybe = {FLAG_NFC_MAYBE};\n\n")
+    out.write("    struct NormalizationRecord final {\n")
+    out.write("        u8 combining_class;\n        u8 flags;\n    };\n\n")
+    out.write(f"    constexpr std::array<NormalizationRecord, {len(ordered)}> normalization_records {{{{\n")
+    for record in ordered:
+        out.write(f"            {{{record[0]}, {record[1]}}},\n")
+    out.write("    }};\n\n")
+    write_array(out, "normalization_stage1", stage1)
+    write_array(out, "normalization_stage2", stage2)
+    write_array(out, "decomposition_keys", decomposition_keys)
+    write_array(out, "decomposition_offsets", decomposition_offsets)
+    write_array(out, "decomposition_data", decomposition_data)
+    write_array(out, "composition_keys", composition_keys)
+    write_array(out, "composition_values", [compositions[key] for key in composition_keys])
+    out.write("}// namespace kstd::unicode::tables\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,80 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <array>
+#include <fmt/format.h>
+#include <kstd/interner.hpp>
+#include <kstd/layout.hpp>
+#include <kstd/non_zero.hpp>
+#include <kstd/option.hpp>
+#include <kstd/relative_ptr.hpp>
+#include <kstd/result.hpp>
+#include <kstd/slice.hpp>
+#include <kstd/static_vector.hpp>
+#include <kstd/tuple.hpp>
+#include <string>
+
+#define KSTD_LAYOUT_ENTRY(...) kstd::get_layout_info<__VA_ARGS__>(#__VA_ARGS__)
+
+/**
+ * Prints the layout of commonly used kstd instantiations,
+ * so size regressions and improvements can be compared between builds.
+ */
+auto main() -> int {
+    using namespace kstd;
+    const std::array entries {
+            KSTD_LAYOUT_ENTRY(Box<i32>),
+            KSTD_LAYOUT_ENTRY(Box<i32&>),
+            KSTD_LAYOUT_ENTRY(Box<std::string>),
+            KSTD_LAYOUT_ENTRY(Box<NonZero<u32>>),
+            KSTD_LAYOUT_ENTRY(Option<u8>),
+            KSTD_LAYOUT_ENTRY(Option<i32>),
+            KSTD_LAYOUT_ENTRY(Option<u64>),
+            KSTD_LAYOUT_ENTRY(Option<i32&>),
+            KSTD_LAYOUT_ENTRY(Option<i32*>),
+            KSTD_LAYOUT_ENTRY(Option<NonZero<u32>>),
+            KSTD_LAYOUT_ENTRY(Option<Symbol>),
+            KSTD_LAYOUT_ENTRY(Option<std::string>),
+            KSTD_LAYOUT_ENTRY(Result<i32>),
+            KSTD_LAYOUT_ENTRY(Result<i32&>),
+            KSTD_LAYOUT_ENTRY(Result<void>),
+            KSTD_LAYOUT_ENTRY(Result<i32, i32>),
+            KSTD_LAYOUT_ENTRY(Result<u64, u8>),
+            KSTD_LAYOUT_ENTRY(Result<i32&, u32>),
+            KSTD_LAYOUT_ENTRY(Result<void, i32>),
+            KSTD_LAYOUT_ENTRY(Tuple<i32, i64>),
+            KSTD_LAYOUT_ENTRY(Tuple<u8, u64, u8>),
+            KSTD_LAYOUT_ENTRY(StaticVector<i32, 8>),
+            KSTD_LAYOUT_ENTRY(StaticVector<u8, 3>),
+            KSTD_LAYOUT_ENTRY(RelativePtr<i32>),
+            KSTD_LAYOUT_ENTRY(RelativePtr<i32, u8>),
+            KSTD_LAYOUT_ENTRY(RelativePtr<i32, u64>),
+            KSTD_LAYOUT_ENTRY(NonZero<u32>),
+            KSTD_LAYOUT_ENTRY(Slice<u8>),
+    };
+
+    fmt::print("{:<24} {:>6} {:>6} {:>8} {:>9} {:>9} {:>9}\n", "Type", "Size", "Align", "Padding", "TrivCopy",
+               "TrivDtor", "StdLayout");
+    for(const auto& entry : entries) {
+        fmt::print("{:<24} {:>6} {:>6} {:>8} {:>9} {:>9} {:>9}\n", entry.name, entry.size, entry.alignment,
+                   entry.padding, entry.is_trivially_copyable, entry.is_trivially_destructible,
+                   entry.is_standard_layout);
+    }
+    return 0;
+}